@@ -0,0 +1,85 @@
+///
+/// @file   S2_easy.cpp
+/// @brief  Benchmark the easy special leaves (Deleglise-Rivat
+///         algorithm). A larger alpha increases y and hence the
+///         size of the PiTable that is accessed randomly. Build
+///         primecount using -DWITH_PREFETCH=ON and
+///         -DWITH_PREFETCH=OFF and compare the timings.
+///
+///         Usage: S2_easy [max_x] [alpha] [threads]
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <imath.hpp>
+#include <PhiTiny.hpp>
+#include <S.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+using namespace primecount;
+
+double S2_easy_time(int64_t x, double alpha, int threads)
+{
+  int64_t y = (int64_t) (iroot<3>(x) * alpha);
+  int64_t z = x / y;
+  int64_t c = PhiTiny::get_c(y);
+
+  double time = get_time();
+  S2_easy(x, y, z, c, threads, false);
+  return get_time() - time;
+}
+
+int main(int argc, char** argv)
+{
+  int64_t max_x = (int64_t) 1e16;
+  double alpha = 0;
+  int threads = get_num_threads();
+
+  if (argc > 1)
+    max_x = (int64_t) std::atof(argv[1]);
+  if (argc > 2)
+    alpha = std::atof(argv[2]);
+  if (argc > 3)
+    threads = std::atoi(argv[3]);
+
+  #if defined(ENABLE_PREFETCH)
+    std::cout << "Prefetch: ON" << std::endl;
+  #else
+    std::cout << "Prefetch: OFF" << std::endl;
+  #endif
+
+  std::cout << std::left
+            << std::setw(18) << "x"
+            << std::setw(10) << "alpha"
+            << std::setw(14) << "y"
+            << "S2_easy" << std::endl;
+
+  for (int64_t x = (int64_t) 1e12; x <= max_x; x *= 10)
+  {
+    // By default we use a large alpha so that
+    // PiTable does not fit into the CPU's cache.
+    double max_alpha = (double) iroot<6>(x);
+    double a = (alpha > 0) ? alpha : max_alpha / 2;
+    a = in_between(1.0, a, max_alpha);
+    int64_t y = (int64_t) (iroot<3>(x) * a);
+
+    double secs = S2_easy_time(x, a, threads);
+
+    std::cout << std::setw(18) << x
+              << std::fixed << std::setprecision(2)
+              << std::setw(10) << a
+              << std::setw(14) << y
+              << std::setprecision(3) << secs << std::endl;
+  }
+
+  return 0;
+}
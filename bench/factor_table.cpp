@@ -0,0 +1,83 @@
+///
+/// @file   factor_table.cpp
+/// @brief  Benchmark the construction of the FactorTable (used in
+///         the Deleglise-Rivat algorithm) and FactorTableD (used
+///         in Xavier Gourdon's algorithm) lookup tables for
+///         different sizes and thread counts.
+///
+///         Usage: factor_table [max_z] [max_threads]
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <FactorTable.hpp>
+#include <FactorTableD.hpp>
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+using namespace primecount;
+
+template <typename FactorTable, typename... Args>
+double construction_time(Args... args)
+{
+  double time = get_time();
+  FactorTable factorTable(args...);
+  return get_time() - time;
+}
+
+int main(int argc, char** argv)
+{
+  int64_t max_z = (int64_t) 1e9;
+  int max_threads = get_num_threads();
+
+  if (argc > 1)
+    max_z = (int64_t) std::atof(argv[1]);
+  if (argc > 2)
+    max_threads = std::atoi(argv[2]);
+
+  std::cout << std::left
+            << std::setw(16) << "Table"
+            << std::setw(14) << "z"
+            << std::setw(10) << "Threads"
+            << "Seconds" << std::endl;
+
+  for (int64_t z = (int64_t) 1e7; z <= max_z; z *= 10)
+  {
+    for (int threads = 1; threads <= max_threads; threads *= 2)
+    {
+      // In Xavier Gourdon's algorithm z ~ 2 * y
+      int64_t y = z / 2;
+      double secs;
+
+      if (z <= FactorTable<uint16_t>::max())
+        secs = construction_time<FactorTable<uint16_t>>(z, threads);
+      else
+        secs = construction_time<FactorTable<uint32_t>>(z, threads);
+
+      std::cout << std::setw(16) << "FactorTable"
+                << std::setw(14) << z
+                << std::setw(10) << threads
+                << std::fixed << std::setprecision(3) << secs << std::endl;
+
+      if (z <= FactorTableD<uint16_t>::max())
+        secs = construction_time<FactorTableD<uint16_t>>(y, z, threads);
+      else
+        secs = construction_time<FactorTableD<uint32_t>>(y, z, threads);
+
+      std::cout << std::setw(16) << "FactorTableD"
+                << std::setw(14) << z
+                << std::setw(10) << threads
+                << std::fixed << std::setprecision(3) << secs << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+///
+/// @file   sieve.cpp
+/// @brief  Benchmark the Sieve class. We simulate the hard
+///         special leaves algorithm: for each sieving prime we
+///         count the number of unsieved elements at increasing
+///         stop numbers (the leaves) and then we cross off the
+///         multiples of the sieving prime.
+///
+///         Usage: sieve [max_low] [segment_size]
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <Sieve.hpp>
+#include <generate_primes.hpp>
+#include <primecount-internal.hpp>
+#include <imath.hpp>
+#include <min.hpp>
+
+#include <stdint.h>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+using namespace primecount;
+
+/// Sieve the segments [low, low + segment_size * segments[
+/// using the primes <= sqrt(high). The distance between
+/// consecutive leaves is ~ sqrt(low).
+///
+double sieve_time(uint64_t low,
+                  uint64_t segment_size,
+                  uint64_t segments,
+                  uint64_t& checksum)
+{
+  uint64_t c = 8;
+  uint64_t limit = low + segment_size * segments;
+  uint64_t leaf_dist = max(isqrt(low), 240);
+  auto primes = generate_primes<uint32_t>(isqrt(limit));
+  uint64_t max_b = primes.size() - 1;
+
+  double time = get_time();
+  Sieve sieve(low, segment_size, max_b);
+
+  for (; low < limit; low += segment_size)
+  {
+    uint64_t high = low + segment_size;
+    sieve.pre_sieve(primes, c, low, high);
+    sieve.init_counter(low, high);
+
+    for (uint64_t b = c + 1; b <= max_b; b++)
+    {
+      // Leaves of the larger primes are sparse
+      uint64_t dist = leaf_dist * (1 + b % 8);
+
+      for (uint64_t stop = b % leaf_dist; stop < segment_size; stop += dist)
+        checksum += sieve.count(stop);
+
+      sieve.cross_off_count(primes[b], b);
+    }
+  }
+
+  return get_time() - time;
+}
+
+int main(int argc, char** argv)
+{
+  uint64_t max_low = (uint64_t) 1e14;
+  uint64_t segment_size = 1 << 20;
+
+  if (argc > 1)
+    max_low = (uint64_t) std::atof(argv[1]);
+  if (argc > 2)
+    segment_size = (uint64_t) std::atof(argv[2]);
+
+  segment_size = Sieve::align_segment_size(segment_size);
+
+  std::cout << std::left
+            << std::setw(18) << "low"
+            << std::setw(14) << "Seconds"
+            << "Checksum" << std::endl;
+
+  for (uint64_t low = (uint64_t) 1e8; low <= max_low; low *= 100)
+  {
+    uint64_t low240 = low - low % 240;
+    uint64_t checksum = 0;
+    uint64_t segments = 4;
+    double secs = sieve_time(low240, segment_size, segments, checksum);
+
+    std::cout << std::setw(18) << low
+              << std::fixed << std::setprecision(3)
+              << std::setw(14) << secs
+              << checksum << std::endl;
+  }
+
+  return 0;
+}
@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 #include <algorithm>
+#include <cstddef>
 #include <string>
 #include <utility>
 
@@ -31,12 +32,17 @@ int64_t pi_lmo2(int64_t x);
 int64_t pi_lmo3(int64_t x);
 int64_t pi_lmo4(int64_t x);
 int64_t pi_primesieve(int64_t x);
+int64_t max_sieve_distance(maxint_t x);
+int64_t count_primes(int64_t a, int64_t b, int threads);
+void add_result_anchor(int64_t x, int64_t pix);
 
 std::string pi(const std::string& x, int threads);
 int64_t pi(int64_t x, int threads);
 int64_t pi_noprint(int64_t x, int threads);
 int64_t pi_deleglise_rivat(int64_t x, int threads);
 
+int64_t pi_anchor(int64_t x, int threads, bool print = is_print());
+int64_t pi_table_file(int64_t x);
 int64_t pi_cache(int64_t x, bool print = is_print());
 int64_t pi_deleglise_rivat_64(int64_t x, int threads, bool print = is_print());
 int64_t pi_legendre(int64_t x, int threads, bool print = is_print());
@@ -45,11 +51,13 @@ int64_t pi_lmo5(int64_t x, bool print = is_print());
 int64_t pi_lmo_parallel(int64_t x, int threads, bool print = is_print());
 int64_t pi_meissel(int64_t x, int threads, bool print = is_print());
 int64_t phi(int64_t x, int64_t a, int threads, bool print = is_print());
+maxint_t pi_range(maxint_t a, maxint_t b, int threads, bool print = is_print());
 int64_t P2(int64_t x, int64_t y, int64_t a, int threads, bool print = is_print());
 int64_t P3(int64_t x, int64_t y, int64_t a, int threads, bool print = is_print());
 
 int64_t nth_prime(int64_t n, int threads);
 int64_t nth_prime_64(int64_t n, int threads);
+void nth_prime_64(const int64_t* n, int64_t* res, std::size_t size, int threads);
 
 int64_t Li(int64_t x);
 int64_t Li_inverse(int64_t x);
@@ -84,6 +92,8 @@ double get_alpha_z(int64_t y, int64_t z);
 double get_alpha_lmo(maxint_t x);
 double get_alpha_deleglise_rivat(maxint_t x);
 std::pair<double, double> get_alpha_gourdon(maxint_t x);
+int get_max_threads_D(int64_t xz);
+int get_max_threads_AC(int64_t xz);
 int64_t get_x_star_gourdon(maxint_t x, int64_t y);
 maxint_t get_max_x(double alpha_y);
 maxint_t to_maxint(const std::string& expr);
@@ -41,6 +41,68 @@ typedef struct {
   int64_t hi;
 } pc_int128_t;
 
+/*
+ * Progress of a formula, see primecount_set_progress_callback().
+ * formula: Name of the formula e.g. "AC", "B", "D".
+ * percent: Estimated progress of the formula in percent.
+ * seconds: Elapsed seconds since the formula has started.
+ * sum: Partial sum of the formula computed so far. Only
+ *      the hard special leaves formulas (D, S2_hard) keep
+ *      track of their partial sum, for the other formulas
+ *      sum is 0. Note that the partial sum may be negative.
+ */
+typedef struct {
+  const char* formula;
+  double percent;
+  double seconds;
+  pc_int128_t sum;
+} pc_progress_t;
+
+typedef void (*primecount_progress_callback_t)(const pc_progress_t* progress, void* data);
+
+/*
+ * Cancels computations that are running in another thread,
+ * see primecount_pi_cancellable(). Opaque type, use
+ * primecount_cancel_token_create() to create a token.
+ */
+typedef struct primecount_cancel_token primecount_cancel_token;
+
+/*
+ * Settings of a single computation, see primecount_ctx_pi().
+ * Opaque type, use primecount_ctx_create() to create a context.
+ */
+typedef struct primecount_ctx primecount_ctx;
+
+/*
+ * Handle of an asynchronous computation, see primecount_pi_async().
+ * Opaque type, must be destroyed using primecount_async_destroy().
+ */
+typedef struct primecount_async primecount_async;
+
+/*
+ * Called once an asynchronous computation has finished, from one of
+ * primecount's worker threads. result is the null-terminated result
+ * string or NULL if the computation failed. status is 0 on success,
+ * -1 if an error occurred and -2 if the computation was cancelled.
+ */
+typedef void (*primecount_completion_callback_t)(const char* result, int status, void* data);
+
+/*
+ * Options of primecount_pi_async(), all members may be 0/NULL.
+ * threads: Maximum number of threads, 0 = no limit.
+ * timeout: Cancel the computation after timeout seconds, 0 = no timeout.
+ * progress: Progress callback of this computation only.
+ * completion: Called once the computation has finished.
+ * data: Passed unmodified to the progress and completion callbacks.
+ */
+typedef struct {
+  int threads;
+  double timeout;
+  primecount_progress_callback_t progress;
+  primecount_completion_callback_t completion;
+  void* data;
+} primecount_async_options;
+
 /*
  * Count the number of primes <= x using Xavier Gourdon's
  * algorithm. Uses all CPU cores by default.
@@ -85,6 +147,27 @@ pc_int128_t primecount_pi_128(pc_int128_t x);
  */
 int primecount_pi_str(const char* x, char* res, size_t len);
 
+/*
+ * Count the number of primes inside [a, b].
+ * Short intervals are sieved, for long intervals pi(b) and
+ * pi(a - 1) are computed concurrently using Xavier Gourdon's
+ * algorithm. Uses all CPU cores by default.
+ * Returns -1 if an error occurs.
+ */
+int64_t primecount_pi_range(int64_t a, int64_t b);
+
+/*
+ * 128-bit version of primecount_pi_range(a, b).
+ * @param a, b Null-terminated string integers e.g. "12345".
+ *             Note that b must be <= primecount_get_max_x().
+ * @param res  Result output buffer.
+ * @param len  Length of the res buffer, 32 is always enough.
+ * @return     Returns -1 if an error occurs, else returns the number
+ *             of characters (>= 1) that have been written to the
+ *             res buffer, not counting the terminating null character.
+ */
+int primecount_pi_range_str(const char* a, const char* b, char* res, size_t len);
+
 /*
  * Partial sieve function (a.k.a. Legendre-sum).
  * phi(x, a) counts the numbers <= x that are not divisible
@@ -93,6 +176,58 @@ int primecount_pi_str(const char* x, char* res, size_t len);
  */
 int64_t primecount_phi(int64_t x, int64_t a);
 
+/*
+ * Same as primecount_pi(x) but the computation can be cancelled
+ * from another thread using primecount_cancel(token) or
+ * primecount_cancel_after(token, seconds).
+ * Returns -2 if the computation has been cancelled,
+ * returns -1 if an error occurs.
+ */
+int64_t primecount_pi_cancellable(int64_t x, primecount_cancel_token* token);
+
+/*
+ * Same as primecount_pi_str(x, res, len) but the computation can
+ * be cancelled from another thread using primecount_cancel(token)
+ * or primecount_cancel_after(token, seconds).
+ * Returns -2 if the computation has been cancelled,
+ * returns -1 if an error occurs.
+ */
+int primecount_pi_str_cancellable(const char* x, char* res, size_t len, primecount_cancel_token* token);
+
+/*
+ * Count the number of primes <= x in the background using
+ * primecount's own pool of worker threads. All asynchronous
+ * computations share the number of threads set using
+ * primecount_set_num_threads().
+ * @param x        Null-terminated string integer e.g. "12345".
+ * @param options  May be NULL.
+ * @return         NULL if an error occurs.
+ */
+primecount_async* primecount_pi_async(const char* x, const primecount_async_options* options);
+
+/* Find the nth prime in the background, see primecount_pi_async() */
+primecount_async* primecount_nth_prime_async(const char* n, const primecount_async_options* options);
+
+/* Returns 1 if the computation has finished, else 0 */
+int primecount_async_is_ready(primecount_async* handle);
+
+/*
+ * Wait until the computation has finished and copy its result into
+ * the res buffer. Returns the number of characters that have been
+ * written to res, -1 if an error occurred and -2 if the
+ * computation has been cancelled.
+ */
+int primecount_async_get(primecount_async* handle, char* res, size_t len);
+
+/* Cancel the computation, thread-safe */
+void primecount_async_cancel(primecount_async* handle);
+
+/*
+ * Destroy the handle. This does not cancel the computation, the
+ * completion callback is still called once it has finished.
+ */
+void primecount_async_destroy(primecount_async* handle);
+
 /*
  * Find the nth prime using a combination of the prime counting
  * function and the sieve of Eratosthenes.
@@ -105,6 +240,15 @@ int64_t primecount_phi(int64_t x, int64_t a);
  */
 int64_t primecount_nth_prime(int64_t n);
 
+/*
+ * Find the nth prime of each n: res[i] = nth_prime(n[i]) for
+ * i = 0 to size - 1. Much faster than calling
+ * primecount_nth_prime(n) for each n if many of the nth
+ * primes are close to each other.
+ * Returns -1 if an error occurs, else 0.
+ */
+int primecount_nth_prime_array(const int64_t* n, int64_t* res, size_t size);
+
 /*
  * 128-bit nth prime function.
  * Find the nth prime using a combination of the prime counting
@@ -143,6 +287,128 @@ void primecount_set_num_threads(int num_threads);
  */
 void primecount_set_verify_computation(bool enable);
 
+/*
+ * Register a callback that is called with the progress of
+ * the formulas of the pi(x) computation. The progress is
+ * reported at most every 0.1 seconds per formula. The
+ * callback is called from primecount's worker threads and
+ * must be thread-safe. data is passed unmodified to the
+ * callback. Pass a NULL callback to disable.
+ */
+void primecount_set_progress_callback(primecount_progress_callback_t callback, void* data);
+
+/*
+ * Speed up pi(x) using known values of pi(x) (anchors). If x
+ * is close to an anchor, pi(x) = pi(anchor) +- the number of
+ * primes between the anchor and x, which are counted using
+ * the segmented sieve of Eratosthenes. The anchors consist of
+ * the built-in values of pi(10^k) and pi(2^k), the anchors
+ * added by the user and the results of previous pi(x)
+ * computations. Disabled by default.
+ */
+void primecount_set_anchors(bool enable);
+
+/*
+ * Add the known value pi(x) = pix to the anchors.
+ * The anchor is not verified, an incorrect anchor causes
+ * incorrect pi(x) results. Returns -1 if an error occurs.
+ */
+int primecount_add_anchor(int64_t x, int64_t pix);
+
+/*
+ * Add the anchors from a text file, one anchor per line:
+ * x followed by pi(x) e.g. "1e15 29844570422669".
+ * Returns -1 if an error occurs.
+ */
+int primecount_load_anchors(const char* filename);
+
+/*
+ * Generate a pi table file for x <= max_x. The pi table is a
+ * compressed lookup table of prime counts, it uses 1 bit per
+ * integer not divisible by 2, 3 and 5 plus a 64-bit count per
+ * 240 integers i.e. about 67 bytes per 1000 integers.
+ * Returns -1 if an error occurs.
+ */
+int primecount_generate_pi_table(const char* filename, int64_t max_x);
+
+/*
+ * Memory map a pi table file that has been generated using
+ * primecount_generate_pi_table(). Afterwards pi(x) is computed
+ * in O(1) for all x <= max_x of the pi table file. Loading
+ * another pi table file replaces the current one, the replaced
+ * file stays mapped until the process exits.
+ * Returns -1 if an error occurs.
+ */
+int primecount_load_pi_table(const char* filename);
+
+/*
+ * Create a cancellation token, returns NULL if an error occurs.
+ * The token must be destroyed using
+ * primecount_cancel_token_destroy() once all computations
+ * using the token have finished.
+ */
+primecount_cancel_token* primecount_cancel_token_create(void);
+void primecount_cancel_token_destroy(primecount_cancel_token* token);
+
+/* Cancel all computations using the token, thread-safe */
+void primecount_cancel(primecount_cancel_token* token);
+
+/*
+ * Cancel all computations using the token once the given
+ * number of seconds (from now) have elapsed.
+ */
+void primecount_cancel_after(primecount_cancel_token* token, double seconds);
+
+/*
+ * Create a context, returns NULL if an error occurs. Unlike the
+ * global settings e.g. primecount_set_num_threads(), the settings
+ * of a context only affect the computations that it is passed
+ * to. Hence multiple threads can run independent computations
+ * with different settings at the same time. A context must not
+ * be modified while it is used by a computation.
+ */
+primecount_ctx* primecount_ctx_create(void);
+void primecount_ctx_destroy(primecount_ctx* ctx);
+
+/* Number of threads, 0 = primecount_get_num_threads() */
+void primecount_ctx_set_num_threads(primecount_ctx* ctx, int threads);
+
+/*
+ * Alpha tuning factors, alpha is used by the Deleglise-Rivat
+ * algorithm, alpha_y and alpha_z are used by Xavier Gourdon's
+ * algorithm. Values < 1 = use the default tuning factors.
+ */
+void primecount_ctx_set_alpha(primecount_ctx* ctx, double alpha);
+void primecount_ctx_set_alpha_y(primecount_ctx* ctx, double alpha_y);
+void primecount_ctx_set_alpha_z(primecount_ctx* ctx, double alpha_z);
+
+/*
+ * Memory budget in bytes, 0 = unlimited. If the estimated memory
+ * usage exceeds the budget, fewer threads are used. The
+ * computation fails if the budget is still exceeded using a
+ * single thread.
+ */
+void primecount_ctx_set_max_memory(primecount_ctx* ctx, uint64_t bytes);
+
+/* Print the status and the partial results to stdout */
+void primecount_ctx_set_print(primecount_ctx* ctx, int print);
+
+/* Progress callback of the computations using the context */
+void primecount_ctx_set_progress_callback(primecount_ctx* ctx, primecount_progress_callback_t callback, void* data);
+
+/* Cancellation token of the computations using the context */
+void primecount_ctx_set_cancel_token(primecount_ctx* ctx, primecount_cancel_token* token);
+
+/*
+ * Same as primecount_pi(x), primecount_pi_str(x, res, len) and
+ * primecount_nth_prime(n) but using the settings of the context.
+ * Returns -2 if the computation has been cancelled,
+ * returns -1 if an error occurs.
+ */
+int64_t primecount_ctx_pi(primecount_ctx* ctx, int64_t x);
+int primecount_ctx_pi_str(primecount_ctx* ctx, const char* x, char* res, size_t len);
+int64_t primecount_ctx_nth_prime(primecount_ctx* ctx, int64_t n);
+
 /* Get the primecount version number, in the form “i.j” */
 const char* primecount_version(void);
 
@@ -13,8 +13,13 @@
 #ifndef PRIMECOUNT_HPP
 #define PRIMECOUNT_HPP
 
+#include <atomic>
+#include <functional>
+#include <iosfwd>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 #include <stdint.h>
 
 #define PRIMECOUNT_VERSION "7.20"
@@ -31,6 +36,50 @@ public:
   { }
 };
 
+/// Thrown by the functions that take a cancel_token if the
+/// computation has been cancelled or if its timeout has
+/// expired. All memory used by the computation has been
+/// freed when the exception is caught.
+///
+class primecount_cancelled : public primecount_error
+{
+public:
+  primecount_cancelled(const std::string& msg)
+    : primecount_error(msg)
+  { }
+};
+
+/// Cancels pi(x) computations that are running in another
+/// thread. The computation checks the token regularly and
+/// throws a primecount_cancelled exception once the token has
+/// been cancelled or once its timeout has expired. Hence the
+/// computation stops shortly after it has been cancelled, not
+/// immediately. A cancel_token may be shared by multiple
+/// computations, it must outlive all of them.
+///
+class cancel_token
+{
+public:
+  cancel_token() = default;
+  cancel_token(const cancel_token&) = delete;
+  cancel_token& operator=(const cancel_token&) = delete;
+
+  /// Thread-safe, may be called from any thread
+  void cancel();
+
+  /// Cancel the computation(s) once the given number
+  /// of seconds (from now) have elapsed.
+  ///
+  void set_timeout(double seconds);
+
+  bool is_cancelled() const;
+
+private:
+  std::atomic<bool> cancelled_{false};
+  /// Deadline in microseconds, 0 if there is no deadline
+  std::atomic<int64_t> deadline_{0};
+};
+
 /// pc_int128_t is a portable int128_t type used by primecount's C++ API.
 ///
 /// How to convert a pc_int128_t to an int128_t:
@@ -47,6 +96,124 @@ struct pc_int128_t
   int64_t hi;
 };
 
+/// Progress of a formula, see set_progress_callback().
+/// formula: Name of the formula e.g. "AC", "B", "D".
+/// percent: Estimated progress of the formula in percent.
+/// seconds: Elapsed seconds since the formula has started.
+/// sum: Partial sum of the formula computed so far. Only
+///      the hard special leaves formulas (D, S2_hard) keep
+///      track of their partial sum, for the other formulas
+///      sum is 0. Note that the partial sum may be negative.
+///
+struct pc_progress_t
+{
+  const char* formula;
+  double percent;
+  double seconds;
+  pc_int128_t sum;
+};
+
+class async_result;
+
+/// Options of pi_async() and nth_prime_async().
+/// threads: Maximum number of threads, 0 = no limit. The
+///          threads are shared with all other asynchronous
+///          computations, see pi_async().
+/// timeout: Cancel the computation after timeout seconds,
+///          0 = no timeout. The timeout starts once the
+///          computation is running, the time spent waiting
+///          for a free thread is not included.
+/// progress: Progress callback of this computation only,
+///           see set_progress_callback().
+/// completion: Called once the computation has finished
+///             (successfully or not), from a worker thread.
+///
+struct async_options
+{
+  int threads = 0;
+  double timeout = 0;
+  std::function<void(const pc_progress_t&)> progress;
+  std::function<void(const async_result&)> completion;
+};
+
+struct async_state;
+
+/// Handle of an asynchronous computation, similar to
+/// std::shared_future. Copies of an async_result
+/// refer to the same computation.
+///
+class async_result
+{
+public:
+  async_result() = default;
+  async_result(std::shared_ptr<async_state> state);
+
+  /// Returns false for default constructed objects
+  bool valid() const;
+
+  /// Returns true if the computation has finished
+  bool is_ready() const;
+
+  /// Wait until the computation has finished
+  void wait() const;
+
+  /// Wait at most the given number of seconds,
+  /// returns true if the computation has finished.
+  ///
+  bool wait_for(double seconds) const;
+
+  /// Wait until the computation has finished and return its
+  /// result. Throws the exception of the computation if it
+  /// failed, or primecount_cancelled if it has been cancelled.
+  ///
+  std::string get() const;
+
+  /// Cancel the computation, thread-safe
+  void cancel() const;
+
+  /// The most recent progress of the computation,
+  /// formula is nullptr if there has been no progress
+  /// report yet.
+  ///
+  pc_progress_t progress() const;
+
+private:
+  std::shared_ptr<async_state> state_;
+};
+
+/// Settings of a single pi(x) or nth_prime(n) computation. Unlike
+/// the global settings e.g. set_num_threads(), a context only
+/// affects the computations that it is passed to. Hence multiple
+/// threads can run independent computations with different
+/// settings at the same time. Members that are 0 (or nullptr)
+/// use the global settings.
+///
+/// threads: Number of threads, 0 = get_num_threads().
+/// alpha: Tuning factor of the Deleglise-Rivat algorithm.
+/// alpha_y, alpha_z: Tuning factors of Xavier Gourdon's algorithm.
+/// max_memory: Memory budget in bytes. If the estimated memory
+///             usage exceeds the budget, fewer threads are used.
+///             Throws a primecount_error if the budget is still
+///             exceeded using a single thread.
+/// print: Print the variables, the status and the partial
+///        results of the formulas (like the --status option).
+/// print_stream: Stream used for printing, nullptr = std::cout.
+/// progress: Progress callback of this computation only.
+/// cancel: Cancellation token of this computation.
+///
+struct context
+{
+  int threads = 0;
+  double alpha = 0;
+  double alpha_y = 0;
+  double alpha_z = 0;
+  uint64_t max_memory = 0;
+  bool print = false;
+  std::ostream* print_stream = nullptr;
+  std::function<void(const pc_progress_t&)> progress;
+  const cancel_token* cancel = nullptr;
+};
+
 /// Count the number of primes <= x using Xavier Gourdon's
 /// algorithm. Uses all CPU cores by default.
 /// Throws a primecount_error if an error occurs.
@@ -56,6 +223,17 @@ struct pc_int128_t
 ///
 int64_t pi(int64_t x);
 
+/// Same as pi(x) but the computation can be cancelled using
+/// the token. Throws a primecount_cancelled exception if the
+/// computation has been cancelled.
+///
+int64_t pi(int64_t x, const cancel_token& token);
+
+/// Same as pi(x) but uses the settings of the context
+/// instead of the global settings.
+///
+int64_t pi(int64_t x, const context& ctx);
+
 /// 128-bit prime counting function.
 /// Count the number of primes <= x using Xavier Gourdon's
 /// algorithm. Uses all CPU cores by default.
@@ -80,6 +258,40 @@ pc_int128_t pi(pc_int128_t x);
 ///
 std::string pi(const std::string& x);
 
+/// Same as pi(const std::string& x) but the computation can be
+/// cancelled using the token. Throws a primecount_cancelled
+/// exception if the computation has been cancelled.
+///
+std::string pi(const std::string& x, const cancel_token& token);
+
+/// Same as pi(const std::string& x) but uses the settings
+/// of the context instead of the global settings.
+///
+std::string pi(const std::string& x, const context& ctx);
+
+/// Count the number of primes inside [a, b].
+/// Short intervals are sieved, for long intervals pi(b) and
+/// pi(a - 1) are computed concurrently using Xavier Gourdon's
+/// algorithm. Uses all CPU cores by default.
+/// Throws a primecount_error if an error occurs.
+///
+int64_t pi_range(int64_t a, int64_t b);
+
+/// 128-bit version of pi_range(a, b).
+/// @param a, b Null-terminated string integers e.g. "12345".
+///             Note that b must be <= get_max_x() which is 10^31
+///             on 64-bit systems and 2^63-1 on 32-bit systems.
+/// Throws a primecount_error if an error occurs.
+///
+std::string pi_range(const std::string& a, const std::string& b);
+
+/// Same as pi_range(a, b) but uses the settings of the
+/// context instead of the global settings. The context
+/// is used by both pi(x) computations.
+///
+int64_t pi_range(int64_t a, int64_t b, const context& ctx);
+std::string pi_range(const std::string& a, const std::string& b, const context& ctx);
+
 /// Partial sieve function (a.k.a. Legendre-sum).
 /// phi(x, a) counts the numbers <= x that are not divisible
 /// by any of the first a primes.
@@ -97,6 +309,26 @@ int64_t phi(int64_t x, int64_t a);
 ///
 int64_t nth_prime(int64_t n);
 
+/// Same as nth_prime(n) but the computation can be cancelled
+/// using the token. Throws a primecount_cancelled exception
+/// if the computation has been cancelled.
+///
+int64_t nth_prime(int64_t n, const cancel_token& token);
+
+/// Same as nth_prime(n) but uses the settings of the
+/// context instead of the global settings.
+///
+int64_t nth_prime(int64_t n, const context& ctx);
+
+/// Find the nth prime of each n: res[i] = nth_prime(n[i]).
+/// Much faster than calling nth_prime(n) for each n if many
+/// of the nth primes are close to each other, as the prime
+/// counting function is then only computed once for each
+/// group of nearby nth primes.
+/// Throws a primecount_error if an error occurs.
+///
+std::vector<int64_t> nth_prime(const std::vector<int64_t>& n);
+
 /// 128-bit nth prime function.
 /// Find the nth prime using a combination of the prime counting
 /// function and the sieve of Eratosthenes.
@@ -110,6 +342,23 @@ int64_t nth_prime(int64_t n);
 ///
 pc_int128_t nth_prime(pc_int128_t n);
 
+/// Count the number of primes <= x in the background using
+/// primecount's own pool of worker threads. All asynchronous
+/// computations share the number of threads set using
+/// set_num_threads(): a new computation is assigned its fair
+/// share of the threads that are not used by the other
+/// asynchronous computations, and waits in a queue if all
+/// threads are in use. The computation is independent of the
+/// calling thread, its settings are those of the options.
+/// Throws a primecount_error if x is not a valid number.
+///
+async_result pi_async(int64_t x, const async_options& options = async_options());
+async_result pi_async(const std::string& x, const async_options& options = async_options());
+
+/// Find the nth prime in the background, see pi_async()
+async_result nth_prime_async(int64_t n, const async_options& options = async_options());
+async_result nth_prime_async(const std::string& n, const async_options& options = async_options());
+
 /// Largest number supported by pi(const std::string& x).
 /// @return 64-bit CPUs: 10^31,
 ///         32-bit CPUs: 2^63-1.
@@ -132,6 +381,51 @@ void set_num_threads(int num_threads);
 ///
 void set_verify_computation(bool enable);
 
+/// Register a callback that is called with the progress of
+/// the formulas of the pi(x) computation. The progress is
+/// reported at most every 0.1 seconds per formula. The
+/// callback is called from primecount's worker threads and
+/// must be thread-safe, exceptions thrown by the callback
+/// are ignored. Pass an empty std::function to disable.
+///
+void set_progress_callback(std::function<void(const pc_progress_t&)> callback);
+
+/// Speed up pi(x) using known values of pi(x) (anchors). If x
+/// is close to an anchor, pi(x) = pi(anchor) +- the number of
+/// primes between the anchor and x, which are counted using
+/// the segmented sieve of Eratosthenes. The anchors consist of
+/// the built-in values of pi(10^k) and pi(2^k), the anchors
+/// added by the user and the results of previous pi(x)
+/// computations. Disabled by default.
+///
+void set_anchors(bool enable);
+
+/// Add the known value pi(x) = pix to the anchors.
+/// The anchor is not verified, an incorrect anchor
+/// causes incorrect pi(x) results.
+///
+void add_anchor(int64_t x, int64_t pix);
+
+/// Add the anchors from a text file, one anchor per line:
+/// x followed by pi(x) e.g. "1e15 29844570422669".
+///
+void load_anchors(const std::string& filename);
+
+/// Generate a pi table file for x <= max_x. The pi table is a
+/// compressed lookup table of prime counts, it uses 1 bit per
+/// integer not divisible by 2, 3 and 5 plus a 64-bit count per
+/// 240 integers i.e. about 67 bytes per 1000 integers.
+///
+void generate_pi_table(const std::string& filename, int64_t max_x);
+
+/// Memory map a pi table file that has been generated using
+/// generate_pi_table(). Afterwards pi(x) is computed in O(1)
+/// for all x <= max_x of the pi table file. Loading another
+/// pi table file replaces the current one, the replaced
+/// file stays mapped until the process exits.
+///
+void load_pi_table(const std::string& filename);
+
 /// Get the primecount version number, in the form “i.j”
 std::string primecount_version();
 
@@ -0,0 +1,37 @@
+///
+/// @file   sieve_bits.hpp
+/// @brief  Internal entry point that sieves the primes inside
+///         [low, high[ directly into a caller provided bit array.
+///         This header is not installed, it is used by primecount.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef SIEVE_BITS_HPP
+#define SIEVE_BITS_HPP
+
+#include <stdint.h>
+#include <cstddef>
+
+namespace primesieve {
+
+/// Sieve the primes >= 7 inside [low, high[ and store them in
+/// the bit array bits[0], bits[stride], bits[stride * 2], ...
+/// Each bit corresponds to an integer that is not divisible by
+/// 2, 3 and 5, the 8 bits of each byte correspond to the offsets
+/// { 1, 7, 11, 13, 17, 19, 23, 29 }. Hence one 64-bit word
+/// corresponds to an interval of size 240 and the bit array
+/// must have (high - low + 239) / 240 words.
+/// @pre low % 240 == 0
+///
+void sieve_bits(uint64_t low,
+                uint64_t high,
+                uint64_t* bits,
+                std::size_t stride = 1);
+
+} // namespace
+
+#endif
@@ -0,0 +1,158 @@
+///
+/// @file   SieveBits.cpp
+/// @brief  Sieve the primes inside [low, high[ directly into a bit
+///         array whose bits correspond to the offsets { 1, 7, 11,
+///         13, 17, 19, 23, 29 } (used by primecount). Our sieve
+///         array uses the offsets { 7, 11, 13, 17, 19, 23, 29, 31 }
+///         instead. However both bit arrays enumerate the integers
+///         that are not divisible by 2, 3 and 5 in increasing order,
+///         hence the two bit arrays only differ by a constant shift
+///         of a few bits. So after a segment has been sieved, we
+///         convert it using a funnel shift of 2 adjacent 64-bit
+///         words, this is much faster than iterating over the primes.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "Erat.hpp"
+#include "MemoryPool.hpp"
+#include "SievingPrimes.hpp"
+
+#include <primesieve/sieve_bits.hpp>
+#include <primesieve/forward.hpp>
+#include <primesieve/littleendian_cast.hpp>
+#include <primesieve/macros.hpp>
+#include <primesieve/pmath.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstddef>
+
+namespace {
+
+using namespace primesieve;
+
+class SieveBits : public Erat
+{
+public:
+  SieveBits(uint64_t low,
+            uint64_t high,
+            uint64_t* bits,
+            std::size_t stride);
+  void sieve();
+
+private:
+  uint64_t* bits_;
+  std::size_t stride_;
+  std::size_t size_;
+  /// Index of the next word of our bit array
+  std::size_t i_ = 0;
+  /// Previous 64-bit word of the sieve array
+  uint64_t prev_ = 0;
+  /// Funnel shift of 2 adjacent sieve array words
+  int shift_ = 0;
+  MemoryPool memoryPool_;
+  void convert(uint64_t word);
+};
+
+SieveBits::SieveBits(uint64_t low,
+                     uint64_t high,
+                     uint64_t* bits,
+                     std::size_t stride) :
+  bits_(bits),
+  stride_(stride),
+  size_(ceilDiv(high - low, 240))
+{
+  ASSERT(low % 240 == 0);
+  ASSERT(low < high);
+
+  for (std::size_t i = 0; i < size_; i++)
+    bits_[i * stride_] = 0;
+
+  // The first bit of the sieve array corresponds to
+  // segmentLow + 7. For low = 0 the sieve array starts at
+  // 0 + 7, the bit of 1 (not a prime) is prepended. For
+  // low > 0 the sieve array starts at (low - 30) + 7, its
+  // first 7 bits (< low) are skipped.
+  uint64_t start = std::max<uint64_t>(low + 1, 7);
+  uint64_t stop = high - 1;
+  shift_ = (low == 0) ? 63 : 7;
+
+  if (start <= stop)
+    Erat::init(start, stop, get_sieve_size(), memoryPool_);
+}
+
+/// Our word i = (prev >> shift) | (word << (64 - shift))
+void SieveBits::convert(uint64_t word)
+{
+  uint64_t bits = (prev_ >> shift_) | (word << (64 - shift_));
+  prev_ = word;
+
+  if (i_ < size_)
+    bits_[i_ * stride_] = bits;
+
+  i_++;
+}
+
+void SieveBits::sieve()
+{
+  uint64_t sieveSize = get_sieve_size();
+  SievingPrimes sievingPrimes(this, sieveSize, memoryPool_);
+  uint64_t prime = sievingPrimes.next();
+  bool isFirst = true;
+
+  while (hasNextSegment())
+  {
+    uint64_t sqrtHigh = isqrt(segmentHigh_);
+
+    for (; prime <= sqrtHigh; prime = sievingPrimes.next())
+      addSievingPrime(prime);
+
+    sieveSegment();
+
+    ASSERT(sieve_.capacity() % sizeof(uint64_t) == 0);
+    std::size_t words = ceilDiv(sieve_.size(), sizeof(uint64_t));
+    const uint8_t* sieve = sieve_.data();
+
+    for (std::size_t j = 0; j < words; j++)
+    {
+      uint64_t word = littleendian_cast<uint64_t>(&sieve[j * 8]);
+
+      // For low > 0 the first word of the sieve array
+      // does not complete any of our words.
+      if (isFirst && shift_ == 7)
+      {
+        prev_ = word;
+        isFirst = false;
+        continue;
+      }
+
+      isFirst = false;
+      convert(word);
+    }
+  }
+
+  // Flush the last word
+  convert(0);
+}
+
+} // namespace
+
+namespace primesieve {
+
+void sieve_bits(uint64_t low,
+                uint64_t high,
+                uint64_t* bits,
+                std::size_t stride)
+{
+  if (low >= high)
+    return;
+
+  SieveBits sieveBits(low, high, bits, stride);
+  sieveBits.sieve();
+}
+
+} // namespace
@@ -0,0 +1,142 @@
+///
+/// @file  AsyncPool.cpp
+/// @brief Pool of worker threads used by pi_async() and
+///        nth_prime_async(). The worker threads are created on
+///        demand (at most get_num_threads() worker threads) and
+///        run the jobs in FIFO order. Each job holds a
+///        ThreadLease while it runs, so the jobs draw from the
+///        same thread budget as all other pi(x) computations.
+///        The OpenMP parallel regions of a job are limited to
+///        the threads of its lease.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <AsyncPool.hpp>
+#include <ThreadLease.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+namespace primecount {
+
+AsyncPool& AsyncPool::get()
+{
+  static AsyncPool pool;
+  return pool;
+}
+
+/// Called at process exit: the running and the queued
+/// jobs are cancelled and the worker threads are joined
+/// so that no worker thread is still running during the
+/// destruction of the other static objects.
+///
+AsyncPool::~AsyncPool()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  is_stopped_ = true;
+
+  for (Task& task : queue_)
+    task.cancel();
+  for (Task& task : running_)
+    task.cancel();
+
+  cv_.notify_all();
+  lock.unlock();
+
+  for (std::thread& thread : threads_)
+  {
+    // exit() may have been called by a job
+    if (thread.get_id() == std::this_thread::get_id())
+      thread.detach();
+    else
+      thread.join();
+  }
+}
+
+void AsyncPool::submit(Job job, Cancel cancel, int max_threads)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  queue_.push_back(Task{std::move(job), std::move(cancel), max_threads});
+
+  if (is_stopped_)
+    queue_.back().cancel();
+
+  if (idle_workers_ == 0 &&
+      workers_ < ThreadLease::max_threads())
+  {
+    workers_++;
+    threads_.emplace_back([this] { worker(); });
+  }
+
+  cv_.notify_all();
+}
+
+/// A job can start if there is at least 1 unused thread.
+/// If no job of the pool is running, a job always starts
+/// (using a single thread), even if other computations
+/// use all threads.
+///
+bool AsyncPool::is_runnable() const
+{
+  return !queue_.empty() &&
+         (running_.empty() ||
+          ThreadLease::available_threads() > 0);
+}
+
+void AsyncPool::worker()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while (true)
+  {
+    idle_workers_++;
+    auto is_ready = [this] {
+      return is_runnable() || (is_stopped_ && queue_.empty());
+    };
+
+    // Threads released by computations that do not run
+    // in the pool are not signaled, hence we poll
+    // while jobs are waiting in the queue.
+    while (!is_ready())
+    {
+      if (queue_.empty())
+        cv_.wait(lock);
+      else
+        cv_.wait_for(lock, std::chrono::milliseconds(50));
+    }
+
+    idle_workers_--;
+
+    if (queue_.empty())
+      return;
+
+    auto task = running_.insert(running_.end(), std::move(queue_.front()));
+    queue_.pop_front();
+
+    // Fair share of the unused threads, the jobs
+    // that are still queued get the same share.
+    int unused_threads = ThreadLease::available_threads();
+    int jobs = (int) queue_.size() + 1;
+    int threads = std::max(1, unused_threads / jobs);
+    if (task->max_threads > 0)
+      threads = std::min(threads, task->max_threads);
+
+    {
+      ThreadLease lease(threads);
+      lock.unlock();
+      task->job(lease.threads());
+      lock.lock();
+    }
+
+    running_.erase(task);
+    cv_.notify_all();
+  }
+}
+
+} // namespace
@@ -0,0 +1,72 @@
+///
+/// @file  AsyncPool.hpp
+/// @brief Pool of worker threads used by pi_async() and
+///        nth_prime_async(). Each job is assigned its fair share
+///        of the threads that are not used by the other
+///        computations (see ThreadLease.hpp), so that all
+///        computations together use at most get_num_threads()
+///        threads. Jobs wait in a queue while all threads are
+///        in use. At process exit the
+///        pool cancels all jobs and joins its worker threads.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef ASYNCPOOL_HPP
+#define ASYNCPOOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace primecount {
+
+class AsyncPool
+{
+public:
+  /// The job is called with the number of
+  /// threads it has been assigned.
+  ///
+  using Job = std::function<void(int threads)>;
+
+  /// Cancels the job, used at process exit.
+  /// A cancelled job must return shortly.
+  ///
+  using Cancel = std::function<void()>;
+
+  static AsyncPool& get();
+  void submit(Job job, Cancel cancel, int max_threads);
+  ~AsyncPool();
+
+private:
+  struct Task
+  {
+    Job job;
+    Cancel cancel;
+    int max_threads;
+  };
+
+  AsyncPool() = default;
+  void worker();
+  bool is_runnable() const;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Task> queue_;
+  std::list<Task> running_;
+  std::vector<std::thread> threads_;
+  bool is_stopped_ = false;
+  int workers_ = 0;
+  int idle_workers_ = 0;
+};
+
+} // namespace
+
+#endif
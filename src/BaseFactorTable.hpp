@@ -13,7 +13,11 @@
 #ifndef BASEFACTORTABLE_HPP
 #define BASEFACTORTABLE_HPP
 
+#include <primecount-internal.hpp>
+#include <generate_primes.hpp>
+#include <ThreadLease.hpp>
 #include <imath.hpp>
+#include <int128_t.hpp>
 #include <macros.hpp>
 #include <Vector.hpp>
 
@@ -72,8 +76,201 @@ protected:
     return multiple;
   }
 
+  /// Initialize the factor[n] lookup table for n <= max_n.
+  /// Numbers with a prime factor > y are set to 0 (for the
+  /// FactorTable used in the Deleglise-Rivat algorithm y = max_n).
+  ///
+  /// The table is split into tiles that fit into the CPU's L2
+  /// cache, each tile is sieved using the primes <= sqrt(high).
+  /// Since the sieving primes are small, their next multiples can
+  /// be carried from one tile to the next. Each square free number
+  /// n has at most one prime factor q > sqrt(high) which we find
+  /// using the product of n's small prime factors: q = n / product.
+  ///
+  /// If prime_index = true we store 2 * pi[lpf] + 1 instead
+  /// of lpf, this is used by the 16-bit FactorTableD for
+  /// large z (lpf > 2^16).
+  ///
+  template <typename T>
+  static void init_factor(Vector<T>& factor,
+                          int64_t y,
+                          int64_t max_n,
+                          int threads,
+                          bool prime_index = false)
+  {
+    ASSERT(max_n >= 1);
+    int64_t size = to_index(max_n) + 1;
+    factor.resize(size);
+
+    // 480 * 128 entries * (sizeof(T) + 8 bytes) <= 720 KiB
+    int64_t tile_size = 480 * 128;
+    int64_t tiles = ceil_div(size, tile_size);
+    int64_t thread_threshold = (int64_t) 1e7;
+    threads = ideal_num_threads(max_n, threads, thread_threshold);
+    ThreadLease lease(threads);
+    threads = lease.threads();
+
+    // The tiles are distributed dynamically amongst the threads
+    // in groups of consecutive tiles. Using 8 groups per thread
+    // ensures that all threads finish at nearly the same time.
+    int64_t groups = std::min(tiles, (int64_t) threads * 8);
+    int64_t group_tiles = ceil_div(tiles, groups);
+    groups = ceil_div(tiles, group_tiles);
+    Vector<int64_t> primes = generate_primes<int64_t>(isqrt(max_n));
+
+    #pragma omp parallel num_threads(threads)
+    {
+      Vector<uint64_t> product(tile_size);
+      Vector<int64_t> multiples(primes.size());
+      Vector<int64_t> squares(primes.size());
+
+      #pragma omp for schedule(dynamic)
+      for (int64_t g = 0; g < groups; g++)
+      {
+        int64_t first = g * group_tiles;
+        int64_t last = std::min(first + group_tiles, tiles);
+        std::size_t sieving_primes = 0;
+
+        for (int64_t t = first; t < last; t++)
+        {
+          int64_t low_idx = t * tile_size;
+          int64_t high_idx = std::min(low_idx + tile_size, size);
+          sieve_tile(factor, product, primes, multiples, squares,
+                     sieving_primes, y, prime_index, low_idx, high_idx);
+        }
+      }
+    }
+  }
+
   static const Array<uint16_t, 480> coprime_;
   static const Array<int16_t, 2310> coprime_indexes_;
+
+private:
+  /// Sieve factor[low_idx, high_idx[. multiples[i] and squares[i]
+  /// contain the indexes of the next multiples of primes[i] that
+  /// have not yet been crossed off, they are valid for
+  /// i < sieving_primes and carried over to the next tile.
+  ///
+  template <typename T>
+  static void sieve_tile(Vector<T>& factor,
+                         Vector<uint64_t>& product,
+                         const Vector<int64_t>& primes,
+                         Vector<int64_t>& multiples,
+                         Vector<int64_t>& squares,
+                         std::size_t& sieving_primes,
+                         int64_t y,
+                         bool prime_index,
+                         int64_t low_idx,
+                         int64_t high_idx)
+  {
+    T T_MAX = pstd::numeric_limits<T>::max();
+    int64_t low = to_number(low_idx);
+    int64_t high = to_number(high_idx - 1);
+    int64_t size = high_idx - low_idx;
+    T* tile = &factor[low_idx];
+
+    // Default initialize memory to all bits set
+    std::fill_n(tile, size, T_MAX);
+    std::fill_n(&product[0], size, 1);
+
+    // mu(1) = 1.
+    // 1 has zero prime factors, hence 1 has an even
+    // number of prime factors. We use the least
+    // significant bit to indicate whether the number
+    // has an even or odd number of prime factors.
+    if (low_idx == 0)
+      tile[0] = T_MAX ^ 1;
+
+    // The first sieving prime is 13 = primes[6]
+    int64_t sqrt_high = isqrt(high);
+    std::size_t i = 6;
+
+    for (; i < primes.size() && primes[i] <= sqrt_high; i++)
+    {
+      int64_t prime = primes[i];
+      T lpf = (T) (prime_index ? i * 2 + 1 : prime);
+
+      if (i >= sieving_primes)
+      {
+        // Find multiples > prime, if prime > y then
+        // prime itself also needs to be sieved out.
+        // next_multiple() returns the index following
+        // the index of the next multiple >= low.
+        multiples[i] = (prime > y) ? 0 : 1;
+        squares[i] = 0;
+        next_multiple(prime, low, &multiples[i]);
+        next_multiple(prime * prime, low, &squares[i]);
+        multiples[i]--;
+        squares[i]--;
+        sieving_primes = i + 1;
+      }
+
+      int64_t j = multiples[i];
+      int64_t multiple = prime * to_number(j);
+
+      if (prime > y)
+      {
+        // Sieve out primes > y &&
+        // Sieve out numbers with prime factors > y
+        for (; multiple <= high; multiple = prime * to_number(++j))
+          tile[to_index(multiple) - low_idx] = 0;
+      }
+      else
+      {
+        for (; multiple <= high; multiple = prime * to_number(++j))
+        {
+          int64_t mi = to_index(multiple) - low_idx;
+          product[mi] *= prime;
+          // prime is the smallest factor of multiple
+          if (tile[mi] == T_MAX)
+            tile[mi] = lpf;
+          // the least significant bit indicates
+          // whether multiple has an even (0) or odd (1)
+          // number of prime factors
+          else if (tile[mi] != 0)
+            tile[mi] ^= 1;
+        }
+
+        int64_t k = squares[i];
+        int64_t square = prime * prime;
+        multiple = square * to_number(k);
+
+        // Sieve out numbers that are not square free
+        // i.e. numbers for which moebius(n) = 0.
+        for (; multiple <= high; multiple = square * to_number(++k))
+          tile[to_index(multiple) - low_idx] = 0;
+
+        squares[i] = k;
+      }
+
+      multiples[i] = j;
+    }
+
+    // Primes > sqrt(high) that have not been used for sieving
+    // this tile need to be reinitialized for the next tile.
+    sieving_primes = std::min(sieving_primes, i);
+
+    // The remaining prime factor q = n / product[n] > sqrt(high)
+    // q > y  <=>  n >= (y + 1) * product[n]
+    uint64_t max_product = pstd::numeric_limits<uint64_t>::max() / (y + 1);
+
+    for (int64_t mi = 0; mi < size; mi++)
+    {
+      uint64_t n = to_number(low_idx + mi);
+
+      if (tile[mi] != 0 &&
+          product[mi] != n)
+      {
+        if (product[mi] <= max_product &&
+            (y + 1) * product[mi] <= n)
+          tile[mi] = 0;
+        // n is not a prime (tile[mi] == T_MAX), hence
+        // n has one additional prime factor.
+        else if (tile[mi] != T_MAX)
+          tile[mi] ^= 1;
+      }
+    }
+  }
 };
 
 } // namespace 
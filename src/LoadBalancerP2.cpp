@@ -12,6 +12,7 @@
 
 #include <LoadBalancerP2.hpp>
 #include <primecount-internal.hpp>
+#include <context.hpp>
 #include <imath.hpp>
 #include <min.hpp>
 
@@ -28,11 +29,16 @@ namespace primecount {
 LoadBalancerP2::LoadBalancerP2(maxint_t x,
                                int64_t sieve_limit,
                                int threads,
-                               bool is_print) :
+                               bool is_print,
+                               const char* formula) :
   low_(isqrt(x)),
   sieve_limit_(sieve_limit),
   precision_(get_status_precision(x)),
-  is_print_(is_print)
+  is_print_(is_print),
+  out_(&get_print_stream()),
+  progress_(formula),
+  cancel_token_(get_cancel_token()),
+  lease_(ThreadLease::get_current())
 {
   low_ = min(low_, sieve_limit_);
   int64_t dist = sieve_limit_ - low_;
@@ -60,9 +66,39 @@ int LoadBalancerP2::get_threads() const
 /// The thread needs to sieve [low, high[
 bool LoadBalancerP2::get_work(int64_t& low, int64_t& high)
 {
-  LockGuard lockGuard(lock_);
-  print_status();
+  // Stop handing out work once the
+  // computation has been cancelled.
+  if (is_cancelled(cancel_token_))
+    return false;
 
+  double percent = -1;
+
+  {
+    LockGuard lockGuard(lock_);
+
+    // Return the thread to the library wide thread budget
+    // if concurrent computations oversubscribe it.
+    if (lease_ && lease_->release_thread())
+      return false;
+
+    print_status();
+    get_work_locked(low, high);
+
+    // Only take a snapshot of the progress here, the
+    // progress callback is called after the lock has
+    // been released.
+    if (progress_.is_due(get_time()))
+      percent = get_percent(low, sieve_limit_);
+  }
+
+  if (percent >= 0)
+    progress_.report(percent, 0);
+
+  return low < sieve_limit_;
+}
+
+void LoadBalancerP2::get_work_locked(int64_t& low, int64_t& high)
+{
   // Calculate the remaining sieving distance
   low_ = min(low_, sieve_limit_);
   int64_t dist = sieve_limit_ - low_;
@@ -72,7 +108,9 @@ bool LoadBalancerP2::get_work(int64_t& low, int64_t& high)
   // is only useful for multi-threading.
   if (threads_ == 1)
   {
-    if (!is_print_)
+    if (!is_print_ &&
+        !progress_.is_enabled() &&
+        !cancel_token_)
       thread_dist_ = dist;
   }
   else
@@ -100,8 +138,6 @@ bool LoadBalancerP2::get_work(int64_t& low, int64_t& high)
   low_ += thread_dist_;
   low_ = min(low_, sieve_limit_);
   high = low_;
-
-  return low < sieve_limit_;
 }
 
 void LoadBalancerP2::print_status()
@@ -118,7 +154,7 @@ void LoadBalancerP2::print_status()
       double percent = get_percent(low_, sieve_limit_);
       std::ostringstream status;
       status << "\rStatus: " << std::fixed << std::setprecision(precision_) << percent << '%';
-      std::cout << status.str() << std::flush;
+      *out_ << status.str() << std::flush;
     }
   }
 }
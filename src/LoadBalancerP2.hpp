@@ -15,19 +15,24 @@
 
 #include <int128_t.hpp>
 #include <OmpLock.hpp>
+#include <cancel.hpp>
+#include <Progress.hpp>
+#include <ThreadLease.hpp>
 
 #include <stdint.h>
+#include <iosfwd>
 
 namespace primecount {
 
 class LoadBalancerP2
 {
 public:
-  LoadBalancerP2(maxint_t x, int64_t sieve_limit, int threads, bool is_print);
+  LoadBalancerP2(maxint_t x, int64_t sieve_limit, int threads, bool is_print, const char* formula);
   bool get_work(int64_t& low, int64_t& high);
   int get_threads() const;
 
 private:
+  void get_work_locked(int64_t& low, int64_t& high);
   void print_status();
 
   int64_t low_ = 0;
@@ -38,6 +43,10 @@ private:
   int threads_ = 0;
   int precision_ = 0;
   bool is_print_ = false;
+  std::ostream* out_;
+  Progress progress_;
+  const cancel_token* cancel_token_ = nullptr;
+  const ThreadLease* lease_ = nullptr;
   OmpLock lock_;
 };
 
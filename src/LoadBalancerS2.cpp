@@ -62,19 +62,25 @@ LoadBalancerS2::LoadBalancerS2(maxint_t x,
                                int64_t sieve_limit,
                                maxint_t sum_approx,
                                int threads,
-                               bool is_print) :
+                               bool is_print,
+                               const char* formula) :
   sieve_limit_(sieve_limit),
   sqrt_limit_(isqrt(sieve_limit)),
   sum_approx_(sum_approx),
   time_(get_time()),
   threads_(threads),
   is_print_(is_print),
-  status_(x)
+  status_(x),
+  progress_(formula),
+  cancel_token_(get_cancel_token()),
+  lease_(ThreadLease::get_current())
 {
   lock_.init(threads);
 
   if (threads == 1 &&
-      !is_print)
+      !is_print &&
+      !progress_.is_enabled() &&
+      !cancel_token_)
   {
     segment_size_ = L1_segment_size;
     segment_size_ = min(segment_size_, sieve_limit);
@@ -108,27 +114,56 @@ maxint_t LoadBalancerS2::get_sum() const
 
 bool LoadBalancerS2::get_work(ThreadData& thread)
 {
-  LockGuard lockGuard(lock_);
-  sum_ += thread.sum;
+  // Stop handing out work once the
+  // computation has been cancelled.
+  if (is_cancelled(cancel_token_))
+    return false;
+
+  bool is_work;
+  bool is_progress = false;
+  double percent = 0;
+  maxint_t sum = 0;
 
-  if (is_print_)
   {
+    LockGuard lockGuard(lock_);
+    sum_ += thread.sum;
+
+    // Return the thread to the library wide thread budget
+    // if concurrent computations oversubscribe it.
+    if (lease_ && lease_->release_thread())
+      return false;
+
     uint64_t dist = thread.segment_size * thread.segments;
     uint64_t high = thread.low + dist;
-    status_.print(high, sieve_limit_, sum_, sum_approx_);
-  }
 
-  update_load_balancing(thread);
+    if (is_print_)
+      status_.print(high, sieve_limit_, sum_, sum_approx_);
+
+    // Only take a snapshot of the progress here, the
+    // progress callback is called after the lock has
+    // been released.
+    if (progress_.is_due(get_time()))
+    {
+      is_progress = true;
+      percent = status_.getPercent(high, sieve_limit_, sum_, sum_approx_);
+      sum = sum_;
+    }
+
+    update_load_balancing(thread);
 
-  thread.low = low_;
-  thread.segments = segments_;
-  thread.segment_size = segment_size_;
-  thread.sum = 0;
-  thread.secs = 0;
-  thread.init_secs = 0;
+    thread.low = low_;
+    thread.segments = segments_;
+    thread.segment_size = segment_size_;
+    thread.sum = 0;
+    thread.secs = 0;
+    thread.init_secs = 0;
+
+    low_ += segment_size_ * segments_;
+    is_work = thread.low < sieve_limit_;
+  }
 
-  low_ += segment_size_ * segments_;
-  bool is_work = thread.low < sieve_limit_;
+  if (is_progress)
+    progress_.report(percent, sum);
 
   return is_work;
 }
@@ -14,6 +14,9 @@
 #include <int128_t.hpp>
 #include <macros.hpp>
 #include <OmpLock.hpp>
+#include <cancel.hpp>
+#include <Progress.hpp>
+#include <ThreadLease.hpp>
 #include <StatusS2.hpp>
 
 #include <stdint.h>
@@ -54,7 +57,7 @@ struct ThreadData
 class LoadBalancerS2
 {
 public:
-  LoadBalancerS2(maxint_t x, int64_t sieve_limit, maxint_t sum_approx, int threads, bool is_print);
+  LoadBalancerS2(maxint_t x, int64_t sieve_limit, maxint_t sum_approx, int threads, bool is_print, const char* formula);
   bool get_work(ThreadData& thread);
   maxint_t get_sum() const;
 
@@ -75,6 +78,9 @@ private:
   int threads_ = 0;
   bool is_print_ = false;
   StatusS2 status_;
+  Progress progress_;
+  const cancel_token* cancel_token_ = nullptr;
+  const ThreadLease* lease_ = nullptr;
   OmpLock lock_;
 };
 
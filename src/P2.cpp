@@ -19,12 +19,14 @@
 ///
 
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
 #include <primesieve.hpp>
 #include <int128_t.hpp>
 #include <macros.hpp>
 #include <min.hpp>
 #include <imath.hpp>
 #include <LoadBalancerP2.hpp>
+#include <cancel.hpp>
 #include <print.hpp>
 
 #include <stdint.h>
@@ -110,7 +112,8 @@ T P2_OpenMP(T x,
   static_assert(pstd::is_signed<T>::value, "T must be signed integer type");
 
   int64_t xy = (int64_t)(x / max(y, 1));
-  LoadBalancerP2 loadBalancer(x, xy, threads, is_print);
+  ThreadLease lease(threads);
+  LoadBalancerP2 loadBalancer(x, xy, lease.threads(), is_print, "P2");
   threads = loadBalancer.get_threads();
 
   // for (low = sqrt(x); low < x / y; low += dist)
@@ -121,6 +124,8 @@ T P2_OpenMP(T x,
       sum += P2_thread(x, y, low, high);
   }
 
+  check_cancelled();
+
   return sum;
 }
 
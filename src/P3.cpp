@@ -10,6 +10,7 @@
 ///
 
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
 #include <generate_primes.hpp>
 #include <imath.hpp>
 #include <macros.hpp>
@@ -55,6 +56,8 @@ int64_t P3(int64_t x,
     // dual-socket AMD EPYC 7642 server with 192 CPU cores.
     int64_t thread_threshold = 100;
     threads = ideal_num_threads(pi_x13, threads, thread_threshold);
+    ThreadLease lease(threads);
+    threads = lease.threads();
 
     #pragma omp parallel for schedule(dynamic, 16) num_threads(threads) reduction(+: sum)
     for (int64_t i = a + 1; i <= pi_x13; i++)
@@ -16,7 +16,9 @@
 
 #include <PiTable.hpp>
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
 #include <primesieve.hpp>
+#include <primesieve/sieve_bits.hpp>
 #include <Vector.hpp>
 #include <imath.hpp>
 #include <macros.hpp>
@@ -128,6 +130,8 @@ void PiTable::init(uint64_t limit,
   uint64_t dist = limit - cache_limit;
   uint64_t thread_threshold = (uint64_t) 1e7;
   threads = ideal_num_threads(dist, threads, thread_threshold);
+  ThreadLease lease(threads);
+  threads = lease.threads();
   uint64_t thread_dist = dist / threads;
   thread_dist = max(thread_threshold, thread_dist);
   thread_dist += 240 - thread_dist % 240;
@@ -159,28 +163,21 @@ void PiTable::init(uint64_t limit,
   }
 }
 
-/// Each thread computes PrimePi [low, high[
+/// Each thread computes PrimePi [low, high[.
+/// primesieve sieves the primes >= 7 directly
+/// into the bits of our pi vector.
+///
 void PiTable::init_bits(uint64_t low,
                         uint64_t high,
                         uint64_t thread_num)
 {
-  // Zero initialize pi vector
   uint64_t i = low / 240;
   uint64_t j = ceil_div(high, 240);
-  std::fill_n(&pi_[i], j - i, pi_t{0, 0});
+  primesieve::sieve_bits(low, high, &pi_[i].bits, sizeof(pi_t) / sizeof(uint64_t));
 
-  // Iterate over primes >= 7
-  low = max(low, 7);
-  primesieve::iterator it(low, high);
   uint64_t count = 0;
-  uint64_t prime = 0;
-
-  while ((prime = it.next_prime()) < high)
-  {
-    uint64_t prime_bit = set_bit_[prime % 240];
-    pi_[prime / 240].bits |= prime_bit;
-    count += 1;
-  }
+  for (; i < j; i++)
+    count += popcnt64(pi_[i].bits);
 
   counts_[thread_num] = count;
 }
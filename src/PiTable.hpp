@@ -55,6 +55,62 @@ public:
     return count + popcnt64(bits & bitmask);
   }
 
+  /// Prefetch the cache line of pi[x]. This allows to hide
+  /// the memory latency of pi[x] lookups whose x is known
+  /// well ahead of time, PiTable is often much larger than
+  /// the CPU's cache.
+  ///
+  ALWAYS_INLINE void prefetch(uint64_t x) const
+  {
+    ASSERT(x <= max_x_);
+
+  #if defined(__GNUC__) || \
+      __has_builtin(__builtin_prefetch)
+    __builtin_prefetch(&pi_[x / 240]);
+  #else
+    (void) x;
+  #endif
+  }
+
+  /// Returns the sum of pi[xl(l)] for min_l < l <= max_l,
+  /// where xl(l) computes the lookup index of l e.g. the
+  /// x / (p * primes[l]) quotients of the sparse easy leaves.
+  /// With ENABLE_PREFETCH this uses software pipelining:
+  /// the indexes of a batch are computed and their cache
+  /// lines are prefetched before the batch is looked up.
+  /// This may hide the memory latency of random lookups
+  /// into a PiTable that is much larger than the CPU's cache.
+  ///
+  template <typename L, typename XL>
+  ALWAYS_INLINE int64_t sum_lookups(L min_l, L max_l, XL xl) const
+  {
+    int64_t sum = 0;
+    L l = max_l;
+
+  #if defined(ENABLE_PREFETCH)
+    constexpr int batch_size = 16;
+
+    for (; l >= min_l + batch_size; l -= batch_size)
+    {
+      uint64_t x[batch_size];
+
+      for (int j = 0; j < batch_size; j++)
+      {
+        x[j] = xl(l - j);
+        prefetch(x[j]);
+      }
+
+      for (int j = 0; j < batch_size; j++)
+        sum += (*this)[x[j]];
+    }
+  #endif
+
+    for (; l > min_l; l--)
+      sum += (*this)[xl(l)];
+
+    return sum;
+  }
+
   /// Get number of primes <= x
   static int64_t pi_cache(uint64_t x)
   {
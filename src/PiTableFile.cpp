@@ -0,0 +1,224 @@
+///
+/// @file  PiTableFile.cpp
+/// @brief The PiTableFile class is a compressed lookup table of
+///        prime counts that is stored in a file and memory mapped.
+///        Once a pi table file has been loaded using
+///        load_pi_table(), pi(x) is computed in O(1) for all
+///        x <= max_x of the file.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <PiTableFile.hpp>
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
+#include <primesieve/sieve_bits.hpp>
+#include <Vector.hpp>
+#include <imath.hpp>
+#include <min.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+namespace {
+
+const char magic[16] = "primecount-pi";
+const uint64_t version = 1;
+
+/// pi_table_file() is called for each pi(x) computation,
+/// hence the lookup only loads the atomic table pointer.
+/// The mutex is only used when loading a table. Replaced
+/// tables are kept (mapped) until the process exits because
+/// concurrent lookups may still be using them.
+///
+std::mutex table_mutex;
+std::vector<std::unique_ptr<const primecount::PiTableFile>> tables;
+std::atomic<const primecount::PiTableFile*> table(nullptr);
+
+} // namespace
+
+namespace primecount {
+
+PiTableFile::Header PiTableFile::get_header(uint64_t max_x)
+{
+  Header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, magic, sizeof(magic));
+  header.version = version;
+  header.max_x = max_x;
+  return header;
+}
+
+PiTableFile::PiTableFile(const std::string& filename)
+{
+  std::ifstream file(filename, std::ios::binary);
+  if (!file)
+    throw primecount_error("failed to open '" + filename + "'");
+
+  Header header;
+  file.read((char*) &header, sizeof(header));
+
+  if (!file ||
+      std::memcmp(header.magic, magic, sizeof(magic)) != 0 ||
+      header.version != version)
+    throw primecount_error("'" + filename + "' is not a pi table file");
+
+  uint64_t size = ceil_div(header.max_x + 1, 240);
+  uint64_t bytes = sizeof(Header) + size * sizeof(pi_t);
+  file.seekg(0, std::ios::end);
+
+  if ((uint64_t) file.tellg() != bytes)
+    throw primecount_error("'" + filename + "' has an invalid size");
+
+#if defined(_WIN32)
+  buffer_.resize(size);
+  file.seekg(sizeof(Header));
+  file.read((char*) buffer_.data(), size * sizeof(pi_t));
+  if (!file)
+    throw primecount_error("failed to read '" + filename + "'");
+  pi_ = buffer_.data();
+#else
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw primecount_error("failed to open '" + filename + "'");
+
+  void* data = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (data == MAP_FAILED)
+    throw primecount_error("failed to memory map '" + filename + "'");
+
+  data_ = data;
+  bytes_ = bytes;
+  pi_ = (const pi_t*) ((const char*) data_ + sizeof(Header));
+#endif
+
+  max_x_ = header.max_x;
+}
+
+PiTableFile::~PiTableFile()
+{
+#if !defined(_WIN32)
+  if (data_)
+    munmap(data_, bytes_);
+#endif
+}
+
+/// Generate the pi table file for x <= max_x. The table is
+/// generated in chunks of 16 MiB that are written to the
+/// file one after another, the primes inside each chunk are
+/// generated in parallel.
+///
+void PiTableFile::generate(const std::string& filename,
+                           uint64_t max_x,
+                           int threads)
+{
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  if (!file)
+    throw primecount_error("failed to create '" + filename + "'");
+
+  Header header = get_header(max_x);
+  file.write((const char*) &header, sizeof(header));
+
+  uint64_t limit = max_x + 1;
+  uint64_t size = ceil_div(limit, 240);
+  uint64_t chunk_size = 1 << 20;
+  uint64_t thread_threshold = (uint64_t) 1e7;
+  Vector<pi_t> pi(min(size, chunk_size));
+
+  // PrimePi(5) = 3
+  uint64_t count = 3;
+  ThreadLease lease(threads);
+  threads = lease.threads();
+
+  for (uint64_t i = 0; i < size; i += chunk_size)
+  {
+    uint64_t j = min(i + chunk_size, size);
+    uint64_t dist = min(j * 240, limit) - i * 240;
+    int chunk_threads = ideal_num_threads(dist, threads, thread_threshold);
+    uint64_t thread_size = ceil_div(j - i, chunk_threads);
+
+    #pragma omp parallel for num_threads(chunk_threads)
+    for (int t = 0; t < chunk_threads; t++)
+    {
+      uint64_t start = i + thread_size * t;
+      uint64_t stop = min(start + thread_size, j);
+
+      if (start < stop)
+        init_bits(&pi[start - i], start * 240, min(stop * 240, limit));
+    }
+
+    for (uint64_t k = 0; k < j - i; k++)
+    {
+      pi[k].count = count;
+      count += popcnt64(pi[k].bits);
+    }
+
+    file.write((const char*) pi.data(), (j - i) * sizeof(pi_t));
+  }
+
+  if (!file)
+    throw primecount_error("failed to write '" + filename + "'");
+}
+
+/// Set the bits of the primes inside [low, high[,
+/// pi[0] corresponds to the interval [low, low + 240[.
+///
+void PiTableFile::init_bits(pi_t* pi,
+                            uint64_t low,
+                            uint64_t high)
+{
+  primesieve::sieve_bits(low, high, &pi[0].bits, sizeof(pi_t) / sizeof(uint64_t));
+}
+
+void load_pi_table(const std::string& filename)
+{
+  std::unique_ptr<const PiTableFile> pi_table(new PiTableFile(filename));
+  std::lock_guard<std::mutex> lock(table_mutex);
+  table.store(pi_table.get(), std::memory_order_release);
+  tables.push_back(std::move(pi_table));
+}
+
+void generate_pi_table(const std::string& filename, int64_t max_x)
+{
+  if (max_x < 0)
+    throw primecount_error("generate_pi_table(filename, max_x): max_x must be >= 0");
+
+  PiTableFile::generate(filename, max_x, get_num_threads());
+}
+
+/// Lookup pi(x) in the loaded pi table file.
+/// Returns -1 if no pi table file has been loaded
+/// or if x is larger than the file's max_x.
+///
+int64_t pi_table_file(int64_t x)
+{
+  const PiTableFile* pi_table = table.load(std::memory_order_acquire);
+
+  if (!pi_table ||
+      x < 0 ||
+      (uint64_t) x > pi_table->max_x())
+    return -1;
+
+  return (*pi_table)[x];
+}
+
+} // namespace
@@ -0,0 +1,96 @@
+///
+/// @file  PiTableFile.hpp
+/// @brief The PiTableFile class is a compressed lookup table of
+///        prime counts that is stored in a file and memory mapped.
+///        It uses the same layout as PiTable: each bit corresponds
+///        to an integer that is not divisible by 2, 3 and 5 and
+///        each array element { count, bits } corresponds to an
+///        interval of size 240. Hence pi(x) is computed using a
+///        single popcount.
+///
+///        File format: a header { magic, version, max_x } followed
+///        by ceil((max_x + 1) / 240) array elements { count, bits }.
+///        All fields are stored as uint64_t in native byte order,
+///        hence the files are not portable across platforms with
+///        different byte order. The file for max_x = 10^12 has a
+///        size of 67 GB (1 bit per 3.75 integers + 64-bit counts).
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PITABLEFILE_HPP
+#define PITABLEFILE_HPP
+
+#include <BitSieve240.hpp>
+#include <popcnt.hpp>
+#include <macros.hpp>
+#include <Vector.hpp>
+
+#include <stdint.h>
+#include <cstddef>
+#include <string>
+
+namespace primecount {
+
+class PiTableFile : public BitSieve240
+{
+public:
+  PiTableFile(const std::string& filename);
+  ~PiTableFile();
+  PiTableFile(const PiTableFile&) = delete;
+  PiTableFile& operator=(const PiTableFile&) = delete;
+
+  static void generate(const std::string& filename,
+                       uint64_t max_x,
+                       int threads);
+
+  uint64_t max_x() const
+  {
+    return max_x_;
+  }
+
+  /// Get number of primes <= x
+  ALWAYS_INLINE int64_t operator[](uint64_t x) const
+  {
+    ASSERT(x <= max_x_);
+
+    if (x < pi_tiny_.size())
+      return pi_tiny_[x];
+
+    uint64_t count = pi_[x / 240].count;
+    uint64_t bits = pi_[x / 240].bits;
+    uint64_t bitmask = unset_larger_[x % 240];
+    return count + popcnt64(bits & bitmask);
+  }
+
+private:
+  struct pi_t
+  {
+    uint64_t count;
+    uint64_t bits;
+  };
+
+  struct Header
+  {
+    char magic[16];
+    uint64_t version;
+    uint64_t max_x;
+  };
+
+  static void init_bits(pi_t* pi, uint64_t low, uint64_t high);
+  static Header get_header(uint64_t max_x);
+  const pi_t* pi_ = nullptr;
+  /// Memory mapped file
+  void* data_ = nullptr;
+  std::size_t bytes_ = 0;
+  /// Used if memory mapping is not supported
+  Vector<pi_t> buffer_;
+  uint64_t max_x_ = 0;
+};
+
+} // namespace
+
+#endif
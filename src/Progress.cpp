@@ -0,0 +1,143 @@
+///
+/// @file  Progress.cpp
+/// @brief Report the progress of the formulas to the callback
+///        that has been registered using set_progress_callback().
+///
+///        The progress reports are rate limited like the status
+///        that is printed to stdout (at most one report per 0.1
+///        seconds per formula). The callback is never called
+///        while holding the lock of a load balancer, hence a
+///        slow callback does not block the other threads from
+///        getting new work.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <Progress.hpp>
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <int128_t.hpp>
+
+#include <exception>
+#include <mutex>
+#include <utility>
+
+namespace {
+
+using namespace primecount;
+
+std::mutex callback_mutex;
+ProgressCallback progress_callback;
+bool is_progress_callback = false;
+
+/// Number of ProgressDisabled objects of the current thread
+thread_local int progress_disabled = 0;
+
+/// Set by ProgressScope
+thread_local const ProgressCallback* scoped_callback = nullptr;
+
+} // namespace
+
+namespace primecount {
+
+void set_progress_callback(std::function<void(const pc_progress_t&)> callback)
+{
+  std::lock_guard<std::mutex> lock(callback_mutex);
+  is_progress_callback = (bool) callback;
+  progress_callback = std::move(callback);
+}
+
+Progress::Progress(const char* formula) :
+  formula_(formula),
+  start_time_(get_time()),
+  time_(start_time_)
+{
+  if (progress_disabled == 0)
+  {
+    if (scoped_callback && *scoped_callback)
+    {
+      callback_ = *scoped_callback;
+      is_enabled_ = true;
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(callback_mutex);
+    if (is_progress_callback)
+    {
+      callback_ = progress_callback;
+      is_enabled_ = true;
+    }
+  }
+}
+
+/// Returns true if at least 0.1 seconds have elapsed since
+/// the last progress report. This method may be called
+/// simultaneously from multiple threads, only one of the
+/// threads wins the race and reports the progress.
+///
+bool Progress::is_due(double time)
+{
+  if (!is_enabled_)
+    return false;
+
+  double old = time_.load(std::memory_order_relaxed);
+
+  return time - old >= threshold_ &&
+         time_.compare_exchange_strong(old, time, std::memory_order_relaxed);
+}
+
+/// The callback is called from the worker threads. Since
+/// exceptions must not escape from OpenMP parallel regions
+/// we ignore exceptions thrown by the callback.
+///
+void Progress::report(double percent, maxint_t sum) const
+{
+  if (!is_enabled_)
+    return;
+
+  pc_progress_t progress;
+  progress.formula = formula_;
+  progress.percent = in_between(0, percent, 100);
+  progress.seconds = get_time() - start_time_;
+  progress.sum.lo = (uint64_t) sum;
+  progress.sum.hi = (int64_t) (sum >> 32 >> 32);
+
+  try
+  {
+    callback_(progress);
+  }
+  catch (const std::exception&)
+  { }
+}
+
+ProgressDisabled::ProgressDisabled()
+{
+  progress_disabled++;
+}
+
+ProgressDisabled::~ProgressDisabled()
+{
+  progress_disabled--;
+}
+
+const ProgressCallback* get_progress_scope()
+{
+  return scoped_callback;
+}
+
+ProgressScope::ProgressScope(const ProgressCallback* callback) :
+  old_callback_(scoped_callback)
+{
+  if (callback && *callback)
+    scoped_callback = callback;
+}
+
+ProgressScope::~ProgressScope()
+{
+  scoped_callback = old_callback_;
+}
+
+} // namespace
@@ -0,0 +1,89 @@
+///
+/// @file  Progress.hpp
+/// @brief Report the progress of the formulas to the callback
+///        that has been registered using set_progress_callback().
+///        Unlike the status that is printed to stdout, the
+///        progress reports are meant to be parsed by programs.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PROGRESS_HPP
+#define PROGRESS_HPP
+
+#include <primecount.hpp>
+#include <int128_t.hpp>
+
+#include <atomic>
+#include <functional>
+
+namespace primecount {
+
+using ProgressCallback = std::function<void(const pc_progress_t&)>;
+
+/// Each formula that supports progress reports creates a
+/// Progress object. The callback is copied when the
+/// Progress object is created, hence changing the callback
+/// does not affect formulas that are currently running.
+///
+class Progress
+{
+public:
+  Progress(const char* formula);
+  bool is_enabled() const { return is_enabled_; }
+  bool is_due(double time);
+  void report(double percent, maxint_t sum) const;
+
+private:
+  const char* formula_;
+  ProgressCallback callback_;
+  double start_time_ = 0;
+  // Only report progress if 0.1 seconds have elapsed
+  // since the last progress report.
+  double threshold_ = 0.1;
+  std::atomic<double> time_;
+  bool is_enabled_ = false;
+};
+
+/// Disables the progress reports of the current thread until
+/// the object goes out of scope. This is used for nested
+/// computations e.g. pi_noprint(x) which is called by many
+/// formulas, only the outermost formulas report progress.
+///
+class ProgressDisabled
+{
+public:
+  ProgressDisabled();
+  ~ProgressDisabled();
+  ProgressDisabled(const ProgressDisabled&) = delete;
+  ProgressDisabled& operator=(const ProgressDisabled&) = delete;
+};
+
+/// Sets the progress callback of the computation running in
+/// the current thread until the object goes out of scope.
+/// While set, it is used instead of the global callback.
+/// If callback is empty the current callback is kept.
+/// This is used by pi_async() for its per call callbacks.
+///
+class ProgressScope
+{
+public:
+  ProgressScope(const ProgressCallback* callback);
+  ~ProgressScope();
+  ProgressScope(const ProgressScope&) = delete;
+  ProgressScope& operator=(const ProgressScope&) = delete;
+private:
+  const ProgressCallback* old_callback_;
+};
+
+/// Returns the progress callback set by ProgressScope
+/// for the current thread or nullptr.
+///
+const ProgressCallback* get_progress_scope();
+
+} // namespace
+
+#endif
@@ -14,6 +14,7 @@
 ///
 
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
 #include <PhiTiny.hpp>
 #include <generate_primes.hpp>
 #include <imath.hpp>
@@ -70,6 +71,8 @@ X S1_OpenMP(X x,
   // dual-socket AMD EPYC 7642 server with 192 CPU cores.
   int64_t thread_threshold = (int64_t) 1e6;
   threads = ideal_num_threads(y, threads, thread_threshold);
+  ThreadLease lease(threads);
+  threads = lease.threads();
 
   auto primes = generate_primes<Y>(y);
   int64_t pi_y = primes.size() - 1;
@@ -43,10 +43,12 @@
 #include <int128_t.hpp>
 #include <macros.hpp>
 #include <min.hpp>
+#include <popcnt.hpp>
 
 #include <stdint.h>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 
 namespace primecount {
 
@@ -64,7 +66,13 @@ Sieve::Sieve(uint64_t low,
   // to 30 numbers i.e. the 8 bits correspond to the
   // offsets = {1, 7, 11, 13, 17, 19, 23, 29}.
   sieve_.resize(segment_size / 30);
+  max_sieve_size_ = sieve_.size();
   wheel_.reserve(wheel_size);
+
+  // Sieving primes > segment_size have at most
+  // one multiple per segment, these are stored
+  // in buckets instead of wheel_.
+  bucket_min_prime_ = segment_size + 1;
   allocate_counter(low);
 }
 
@@ -114,6 +122,29 @@ void Sieve::allocate_counter(uint64_t low)
   counter_.counter.resize(counter_size);
   counter_.dist = bytes * 30;
   counter_.log2_dist = ilog2(bytes);
+
+  // If the distance between consecutive leaves is large
+  // compared to the counter distance, then count(stop)
+  // iterates over many counter elements. In this case we
+  // add a 2nd level to the counter whose elements contain
+  // the sum of 2^log2_blocks counter elements. The number
+  // of counter elements iterated per leaf is minimized if
+  // 2^log2_blocks ~ sqrt(average_leaf_dist / counter_.dist).
+  double counters_per_leaf = average_leaf_dist / counter_.dist;
+  counters_per_leaf = std::min(counters_per_leaf, (double) counter_size);
+  uint64_t blocks = uint64_t(std::sqrt(counters_per_leaf));
+  blocks = next_power_of_2(max(blocks, 1));
+
+  // For fewer than 4 counter elements per super block the
+  // 2nd level does not pay off because cross_off_count()
+  // needs to update both levels.
+  if (blocks >= 4)
+  {
+    counter_.log2_blocks = ilog2(blocks);
+    counter_.log2_super_dist = counter_.log2_dist + counter_.log2_blocks;
+    counter_.super_dist = counter_.dist << counter_.log2_blocks;
+    counter_.super.resize(ceil_div(counter_size, blocks));
+  }
 }
 
 /// The segment size is sieve.size() * 30 as each
@@ -160,6 +191,11 @@ void Sieve::reset_counter()
   counter_.i = 0;
   counter_.sum = 0;
   counter_.stop = counter_.dist;
+  counter_.super_i = 0;
+  counter_.super_sum = 0;
+  counter_.super_stop = counter_.super.empty()
+    ? pstd::numeric_limits<uint64_t>::max()
+    : counter_.super_dist;
 }
 
 void Sieve::init_counter(uint64_t low, uint64_t high)
@@ -182,17 +218,23 @@ void Sieve::init_counter(uint64_t low, uint64_t high)
     total_count_ += cnt;
     start += counter_.dist;
   }
+
+  // Initialize the 2nd level of the counter
+  if (!counter_.super.empty())
+  {
+    std::fill(counter_.super.begin(), counter_.super.end(), 0);
+    uint64_t size = ceil_div(max_stop + 1, counter_.dist);
+
+    for (uint64_t i = 0; i < size; i++)
+      counter_.super[i >> counter_.log2_blocks] += counter_[i];
+  }
 }
 
-/// Add a sieving prime to the sieve.
 /// Calculates the first multiple > start of prime that
 /// is not divisible by 2, 3, 5 and its wheel index.
 ///
-void Sieve::add(uint64_t prime, uint64_t i)
+Sieve::Wheel Sieve::first_multiple(uint64_t prime) const
 {
-  if_unlikely(i > wheel_.size())
-    wheel_.resize(i);
-
   // Find first multiple > start_
   ASSERT(start_ % 30 == 0);
   uint64_t quotient = start_ / prime + 1;
@@ -213,7 +255,65 @@ void Sieve::add(uint64_t prime, uint64_t i)
   // Calculate wheel index of multiple
   uint32_t index = wheel_init[quotient % 30].index;
   index += wheel_offsets[prime % 30];
-  wheel_.push_back({multiple32, index});
+
+  return { multiple32, index };
+}
+
+/// Add a sieving prime to the sieve.
+void Sieve::add(uint64_t prime, uint64_t i)
+{
+  if_unlikely(i > wheel_.size())
+    wheel_.resize(i);
+
+  wheel_.push_back(first_multiple(prime));
+}
+
+/// Add a large sieving prime to the bucket of
+/// the segment that contains its first multiple.
+///
+void Sieve::add_bucket(uint64_t prime, uint64_t i)
+{
+  // Like wheel_, large sieving primes must be
+  // added in the first segment.
+  ASSERT(segment_ == 0);
+  ASSERT(i <= pstd::numeric_limits<uint32_t>::max());
+
+  Wheel wheel = first_multiple(prime);
+  uint64_t segment = wheel.multiple / max_sieve_size_;
+  uint32_t multiple = (uint32_t) (wheel.multiple % max_sieve_size_);
+
+  if (segment >= buckets_.size())
+    buckets_.resize(segment + 1);
+
+  buckets_[segment].push_back({(uint32_t) i, multiple, wheel.index});
+  bucket_next_i_ = i + 1;
+}
+
+/// Called at the start of each new segment. Frees the
+/// bucket of the previous segment and sorts the bucket
+/// of the current segment by the sieving prime's index
+/// (as the sieving primes are crossed off in that order).
+///
+void Sieve::init_bucket(uint64_t low)
+{
+  ASSERT(low >= start_);
+  ASSERT(sieve_.size() == max_sieve_size_);
+  uint64_t segment = (low - start_) / segment_size();
+
+  for (; segment_ < segment && segment_ < buckets_.size(); segment_++)
+    buckets_[segment_].deallocate();
+
+  segment_ = segment;
+  bucket_pos_ = 0;
+
+  if (segment_ < buckets_.size())
+  {
+    auto& bucket = buckets_[segment_];
+    std::sort(bucket.begin(), bucket.end(),
+      [](const SievingPrime& a, const SievingPrime& b) {
+        return a.i < b.i;
+    });
+  }
 }
 
 /// Remove the i-th prime and the multiples of the i-th prime
@@ -221,6 +321,12 @@ void Sieve::add(uint64_t prime, uint64_t i)
 ///
 void Sieve::cross_off(uint64_t prime, uint64_t i)
 {
+  if (prime >= bucket_min_prime_)
+  {
+    cross_off_bucket<false, false>(prime, i);
+    return;
+  }
+
   if (i >= wheel_.size())
     add(prime, i);
 
@@ -478,6 +584,279 @@ void Sieve::cross_off(uint64_t prime, uint64_t i)
 /// whose least prime factor is the i-th prime.
 ///
 void Sieve::cross_off_count(uint64_t prime, uint64_t i)
+{
+  if (prime >= bucket_min_prime_)
+  {
+    if (counter_.super.empty())
+      cross_off_bucket<true, false>(prime, i);
+    else
+      cross_off_bucket<true, true>(prime, i);
+  }
+  else if (prime < max_pattern_prime &&
+           sieve_.size() >= prime * 4)
+  {
+    if (counter_.super.empty())
+      cross_off_count_pattern<false>(prime, i);
+    else
+      cross_off_count_pattern<true>(prime, i);
+  }
+  else
+  {
+    if (counter_.super.empty())
+      cross_off_count<false>(prime, i);
+    else
+      cross_off_count<true>(prime, i);
+  }
+}
+
+/// Small sieving primes have many multiples per segment. The
+/// multiples of a prime are located at the same bits every
+/// prime bytes in the sieve array (as each byte corresponds to
+/// 30 numbers). Hence we generate a small bit pattern (of size
+/// prime bytes) from which the multiples of prime have been
+/// removed and bitwise AND it with the sieve array. Instead of
+/// updating the counter for each crossed off multiple we update
+/// the counter once per counter element using the popcount of
+/// the elements that have been crossed off.
+///
+template <bool IS_TWO_LEVEL_COUNTER>
+void Sieve::cross_off_count_pattern(uint64_t prime, uint64_t i)
+{
+  if (i >= wheel_.size())
+    add(prime, i);
+
+  reset_counter();
+  Wheel& wheel = wheel_[i];
+  uint64_t m = wheel.multiple;
+  uint64_t index = wheel.index;
+  uint64_t sieve_size = sieve_.size();
+  ASSERT(prime < max_pattern_prime);
+  ASSERT(m < sieve_size);
+
+  // pattern[j] corresponds to the sieve array bytes j,
+  // j + prime, j + prime * 2, ... We append 64 bytes
+  // so that 64 bytes can be read at any position < prime.
+  uint8_t pattern[max_pattern_prime + 64];
+  std::fill_n(pattern, prime + 64, 0xff);
+  uint64_t pos = m % prime;
+
+  // 8 consecutive multiples of prime (coprime to 30)
+  // are exactly prime bytes apart.
+  for (int j = 0; j < 8; j++)
+  {
+    const WheelStep& step = wheel_steps[index];
+    pattern[pos] &= ~(1 << step.bit_index);
+    pos += (prime / 30) * step.factor + step.correct;
+    pos -= (pos >= prime) ? prime : 0;
+    index = (index % 8 == 7) ? index - 7 : index + 1;
+  }
+
+  // prime may be < 64
+  for (uint64_t j = prime; j < prime + 64; j++)
+    pattern[j] = pattern[j - prime];
+
+  uint64_t counter_dist = 1ull << counter_.log2_dist;
+  uint64_t total_count = total_count_;
+  pos = 0;
+
+  // Each counter element corresponds to counter_dist bytes
+  // of the sieve array (counter_dist is a power of 2 >= 64).
+  for (uint64_t start = 0; start < sieve_size; start += counter_dist)
+  {
+    uint64_t stop = min(start + counter_dist, sieve_size);
+    uint64_t cnt = cross_off_pattern(pattern, prime, pos, start, stop);
+    uint64_t j = start >> counter_.log2_dist;
+    counter_[j] -= (uint32_t) cnt;
+    if (IS_TWO_LEVEL_COUNTER)
+      counter_.super[start >> counter_.log2_super_dist] -= (uint32_t) cnt;
+    total_count -= cnt;
+  }
+
+  total_count_ = total_count;
+
+  // Find the first multiple >= sieve_size,
+  // the wheel index repeats every prime bytes.
+  m += ((sieve_size - m) / prime) * prime;
+  index = wheel.index;
+
+  while (m < sieve_size)
+  {
+    const WheelStep& step = wheel_steps[index];
+    m += (prime / 30) * step.factor + step.correct;
+    index = (index % 8 == 7) ? index - 7 : index + 1;
+  }
+
+  wheel.multiple = (uint32_t) (m - sieve_size);
+  wheel.index = (uint32_t) index;
+}
+
+/// Bitwise AND the sieve array bytes [start, stop[ with the
+/// pattern and count the number of crossed off elements.
+/// pos is the pattern position of the sieve array byte start.
+///
+uint64_t Sieve::cross_off_pattern(const uint8_t* pattern,
+                                  uint64_t prime,
+                                  uint64_t& pos,
+                                  uint64_t start,
+                                  uint64_t stop)
+{
+  #if defined(ENABLE_AVX512_VPOPCNT)
+    return cross_off_pattern_avx512(pattern, prime, pos, start, stop);
+  #elif defined(ENABLE_MULTIARCH_AVX512_VPOPCNT)
+    if (cpu_supports_avx512_vpopcnt)
+      return cross_off_pattern_avx512(pattern, prime, pos, start, stop);
+    else
+      return cross_off_pattern_default(pattern, prime, pos, start, stop);
+  #else
+    return cross_off_pattern_default(pattern, prime, pos, start, stop);
+  #endif
+}
+
+uint64_t Sieve::cross_off_pattern_default(const uint8_t* pattern,
+                                          uint64_t prime,
+                                          uint64_t& pos,
+                                          uint64_t start,
+                                          uint64_t stop)
+{
+  ASSERT(start % 8 == 0);
+  ASSERT(stop % 8 == 0);
+  uint64_t* sieve64 = (uint64_t*) &sieve_[start];
+  uint64_t words = (stop - start) / 8;
+  uint64_t cnt = 0;
+
+  for (uint64_t i = 0; i < words; i++)
+  {
+    uint64_t bits;
+    std::memcpy(&bits, &pattern[pos], sizeof(uint64_t));
+    cnt += popcnt64(sieve64[i] & ~bits);
+    sieve64[i] &= bits;
+    pos += 8;
+    while (pos >= prime)
+      pos -= prime;
+  }
+
+  return cnt;
+}
+
+#if defined(ENABLE_AVX512_VPOPCNT) || \
+    defined(ENABLE_MULTIARCH_AVX512_VPOPCNT)
+
+#if defined(ENABLE_MULTIARCH_AVX512_VPOPCNT)
+  __attribute__ ((target ("avx512f,avx512vpopcntdq")))
+#endif
+uint64_t Sieve::cross_off_pattern_avx512(const uint8_t* pattern,
+                                         uint64_t prime,
+                                         uint64_t& pos,
+                                         uint64_t start,
+                                         uint64_t stop)
+{
+  ASSERT(start % 8 == 0);
+  ASSERT(stop % 8 == 0);
+  uint8_t* sieve = &sieve_[start];
+  uint64_t bytes = stop - start;
+  uint64_t i = 0;
+  __m512i vcnt = _mm512_setzero_si512();
+
+  for (; i + 64 <= bytes; i += 64)
+  {
+    __m512i vec = _mm512_loadu_si512((const void*) &sieve[i]);
+    __m512i bits = _mm512_loadu_si512((const void*) &pattern[pos]);
+    __m512i unset = _mm512_andnot_si512(bits, vec);
+    vcnt = _mm512_add_epi64(vcnt, _mm512_popcnt_epi64(unset));
+    _mm512_storeu_si512((void*) &sieve[i], _mm512_and_si512(vec, bits));
+    pos += 64;
+    while (pos >= prime)
+      pos -= prime;
+  }
+
+  if (i < bytes)
+  {
+    uint64_t words = (bytes - i) / 8;
+    __mmask8 mask = (__mmask8) (0xff >> (8 - words));
+    __m512i vec = _mm512_maskz_loadu_epi64(mask, &sieve[i]);
+    __m512i bits = _mm512_maskz_loadu_epi64(mask, &pattern[pos]);
+    __m512i unset = _mm512_andnot_si512(bits, vec);
+    vcnt = _mm512_add_epi64(vcnt, _mm512_popcnt_epi64(unset));
+    _mm512_mask_storeu_epi64(&sieve[i], mask, _mm512_and_si512(vec, bits));
+    pos += bytes - i;
+    while (pos >= prime)
+      pos -= prime;
+  }
+
+  return _mm512_reduce_add_epi64(vcnt);
+}
+
+#endif
+
+/// Cross off the multiple of a large sieving prime > segment_size
+/// in the current segment (if any). Unlike cross_off_count() this
+/// does not access the sieving prime's wheel data if it does not
+/// have a multiple in the current segment, which is the common
+/// case for large sieving primes.
+///
+template <bool IS_COUNT, bool IS_TWO_LEVEL_COUNTER>
+void Sieve::cross_off_bucket(uint64_t prime, uint64_t i)
+{
+  if (i >= bucket_next_i_)
+    add_bucket(prime, i);
+
+  if (IS_COUNT)
+    reset_counter();
+
+  if (segment_ >= buckets_.size())
+    return;
+
+  // Skip sieving primes that have not been crossed
+  // off in the current segment, these do not have
+  // any special leaves in the remaining segments.
+  const auto& bucket = buckets_[segment_];
+  while (bucket_pos_ < bucket.size() &&
+         bucket[bucket_pos_].i < i)
+    bucket_pos_++;
+
+  if (bucket_pos_ >= bucket.size() ||
+      bucket[bucket_pos_].i != i)
+    return;
+
+  SievingPrime sp = bucket[bucket_pos_++];
+  uint64_t m = sp.multiple;
+
+  // The last segment may be smaller
+  if (m >= sieve_.size())
+    return;
+
+  const WheelStep& step = wheel_steps[sp.index];
+  uint64_t bit_index = step.bit_index;
+
+  if (IS_COUNT)
+  {
+    std::size_t is_bit = (sieve_[m] >> bit_index) & 1;
+    counter_[m >> counter_.log2_dist] -= (uint32_t) is_bit;
+    if (IS_TWO_LEVEL_COUNTER)
+      counter_.super[m >> counter_.log2_super_dist] -= (uint32_t) is_bit;
+    total_count_ -= (uint64_t) is_bit;
+  }
+
+  sieve_[m] &= ~(1 << bit_index);
+
+  // Move the sieving prime to the
+  // bucket of its next multiple.
+  m += (prime / 30) * step.factor + step.correct;
+  uint64_t segment = segment_ + m / max_sieve_size_;
+  sp.multiple = (uint32_t) (m % max_sieve_size_);
+  sp.index = (sp.index % 8 == 7) ? sp.index - 7 : sp.index + 1;
+
+  if (segment >= buckets_.size())
+    buckets_.resize(segment + 1);
+
+  buckets_[segment].push_back(sp);
+}
+
+/// If IS_TWO_LEVEL_COUNTER = true we also
+/// update the 2nd level of the counter.
+///
+template <bool IS_TWO_LEVEL_COUNTER>
+void Sieve::cross_off_count(uint64_t prime, uint64_t i)
 {
   if (i >= wheel_.size())
     add(prime, i);
@@ -489,8 +868,10 @@ void Sieve::cross_off_count(uint64_t prime, uint64_t i)
   uint64_t m = wheel.multiple;
   uint64_t total_count = total_count_;
   uint64_t counter_log2_dist = counter_.log2_dist;
+  uint64_t super_log2_dist = counter_.log2_super_dist;
   uint64_t sieve_size = sieve_.size();
   uint32_t* counter = &counter_[0];
+  uint32_t* super = counter_.super.data();
   uint8_t* sieve = &sieve_[0];
 
   #define CHECK_FINISHED(wheel_index) \
@@ -508,6 +889,8 @@ void Sieve::cross_off_count(uint64_t prime, uint64_t i)
       std::size_t is_bit = (sieve_byte >> bit_index) & 1; \
       sieve[m] &= ~(1 << bit_index); \
       counter[m >> counter_log2_dist] -= (uint32_t) is_bit; \
+      if (IS_TWO_LEVEL_COUNTER) \
+        super[m >> super_log2_dist] -= (uint32_t) is_bit; \
       total_count -= (uint64_t) is_bit; \
     }
 
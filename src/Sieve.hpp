@@ -64,6 +64,7 @@ public:
   void pre_sieve(const Vector<T>& primes, uint64_t c, uint64_t low, uint64_t high)
   {
     uint64_t primePi = pre_sieve(c, low);
+    init_bucket(low);
     resize_sieve(low, high);
 
     for (uint64_t i = primePi + 1; i <= c; i++)
@@ -111,7 +112,27 @@ public:
 #endif
 
 private:
+  template <bool IS_TWO_LEVEL_COUNTER>
+  void cross_off_count(uint64_t prime, uint64_t i);
+  template <bool IS_COUNT, bool IS_TWO_LEVEL_COUNTER>
+  void cross_off_bucket(uint64_t prime, uint64_t i);
+  template <bool IS_TWO_LEVEL_COUNTER>
+  void cross_off_count_pattern(uint64_t prime, uint64_t i);
+  uint64_t cross_off_pattern(const uint8_t* pattern, uint64_t prime, uint64_t& pos, uint64_t start, uint64_t stop);
+  uint64_t cross_off_pattern_default(const uint8_t* pattern, uint64_t prime, uint64_t& pos, uint64_t start, uint64_t stop);
+
+#if defined(ENABLE_AVX512_VPOPCNT) || \
+    defined(ENABLE_MULTIARCH_AVX512_VPOPCNT)
+  #if defined(ENABLE_MULTIARCH_AVX512_VPOPCNT)
+    __attribute__ ((target ("avx512f,avx512vpopcntdq")))
+  #endif
+  uint64_t cross_off_pattern_avx512(const uint8_t* pattern, uint64_t prime, uint64_t& pos, uint64_t start, uint64_t stop);
+#endif
+
+  uint64_t count_counter(uint64_t start, uint64_t stop);
   void add(uint64_t prime, uint64_t i);
+  void add_bucket(uint64_t prime, uint64_t i);
+  void init_bucket(uint64_t low);
   void allocate_counter(uint64_t low);
   void reset_counter();
   void resize_sieve(uint64_t low, uint64_t high);
@@ -120,12 +141,30 @@ private:
   static const Array<uint64_t, 240> unset_smaller;
   static const Array<uint64_t, 240> unset_larger;
 
+  /// Sieving primes < max_pattern_prime are crossed off
+  /// using cross_off_count_pattern().
+  static constexpr uint64_t max_pattern_prime = 1 << 10;
+
   struct Wheel
   {
     uint32_t multiple;
     uint32_t index;
   };
 
+  /// Sieving primes > segment_size have at most one
+  /// multiple per segment. Similar to primesieve's
+  /// EratBig these are not stored in wheel_, instead
+  /// they are stored in the bucket of the segment that
+  /// contains their next multiple.
+  struct SievingPrime
+  {
+    uint32_t i;
+    uint32_t multiple;
+    uint32_t index;
+  };
+
+  Wheel first_multiple(uint64_t prime) const;
+
   struct Counter
   {
     uint64_t stop = 0;
@@ -135,6 +174,17 @@ private:
     uint64_t i = 0;
     Vector<uint32_t> counter;
 
+    /// Optional 2nd level of the counter, each super
+    /// counter element contains the sum of 2^log2_blocks
+    /// consecutive counter elements. Empty if disabled.
+    uint64_t super_stop = 0;
+    uint64_t super_dist = 0;
+    uint64_t log2_super_dist = 0;
+    uint64_t log2_blocks = 0;
+    uint64_t super_sum = 0;
+    uint64_t super_i = 0;
+    Vector<uint32_t> super;
+
     uint32_t& operator[](std::size_t pos)
     {
       return counter[pos];
@@ -153,6 +203,15 @@ private:
   Vector<uint8_t> sieve_;
   Vector<Wheel> wheel_;
   Counter counter_;
+  /// buckets_[s] contains the large sieving primes
+  /// whose next multiple is located in the s-th
+  /// segment (counted from start_).
+  Vector<Vector<SievingPrime>> buckets_;
+  uint64_t bucket_min_prime_ = 0;
+  uint64_t bucket_next_i_ = 0;
+  uint64_t bucket_pos_ = 0;
+  uint64_t segment_ = 0;
+  uint64_t max_sieve_size_ = 0;
 };
 
 } // namespace
@@ -38,6 +38,47 @@
 
 namespace primecount {
 
+/// Quickly count the number of unsieved elements (in
+/// the sieve array) up to a value that is close to
+/// the stop number i.e. (stop - start) < counter_.dist.
+/// We do this using the counter array, each element
+/// of the counter array contains the number of
+/// unsieved elements in the interval:
+/// [i * counter_.dist, (i + 1) * counter_.dist[.
+/// If the distance between consecutive leaves is large
+/// we first skip whole super blocks using the 2nd level
+/// of the counter (counter_.super).
+/// @return The updated start number
+///
+ALWAYS_INLINE uint64_t Sieve::count_counter(uint64_t start, uint64_t stop)
+{
+  if (counter_.super_stop <= stop)
+  {
+    do
+    {
+      start = counter_.super_stop;
+      counter_.super_stop += counter_.super_dist;
+      counter_.super_sum += counter_.super[counter_.super_i++];
+    }
+    while (counter_.super_stop <= stop);
+
+    counter_.i = counter_.super_i << counter_.log2_blocks;
+    counter_.stop = start + counter_.dist;
+    counter_.sum = counter_.super_sum;
+    count_ = counter_.sum;
+  }
+
+  while (counter_.stop <= stop)
+  {
+    start = counter_.stop;
+    counter_.stop += counter_.dist;
+    counter_.sum += counter_[counter_.i++];
+    count_ = counter_.sum;
+  }
+
+  return start;
+}
+
 /// Count 1 bits inside [0, stop].
 /// This method is safe to run on any CPU without runtime
 /// CPUID checks. In most cases (e.g. when compiled
@@ -70,20 +111,9 @@ ALWAYS_INLINE uint64_t Sieve::count_popcnt64(uint64_t stop)
   if (start > stop)
     return count_;
 
-  // Quickly count the number of unsieved elements (in
-  // the sieve array) up to a value that is close to
-  // the stop number i.e. (stop - start) < counter_.dist.
-  // We do this using the counter array, each element
-  // of the counter array contains the number of
-  // unsieved elements in the interval:
-  // [i * counter_.dist, (i + 1) * counter_.dist[.
-  while (counter_.stop <= stop)
-  {
-    start = counter_.stop;
-    counter_.stop += counter_.dist;
-    counter_.sum += counter_[counter_.i++];
-    count_ = counter_.sum;
-  }
+  // Quickly count the number of unsieved elements
+  // up to a value that is close to the stop number.
+  start = count_counter(start, stop);
 
   // Here the remaining distance is relatively small i.e.
   // (stop - start) < counter_.dist, hence we simply
@@ -133,20 +163,9 @@ ALWAYS_INLINE uint64_t Sieve::count_avx512(uint64_t stop)
   if (start > stop)
     return count_;
 
-  // Quickly count the number of unsieved elements (in
-  // the sieve array) up to a value that is close to
-  // the stop number i.e. (stop - start) < counter_.dist.
-  // We do this using the counter array, each element
-  // of the counter array contains the number of
-  // unsieved elements in the interval:
-  // [i * counter_.dist, (i + 1) * counter_.dist[.
-  while (counter_.stop <= stop)
-  {
-    start = counter_.stop;
-    counter_.stop += counter_.dist;
-    counter_.sum += counter_[counter_.i++];
-    count_ = counter_.sum;
-  }
+  // Quickly count the number of unsieved elements
+  // up to a value that is close to the stop number.
+  start = count_counter(start, stop);
 
   // Here the remaining distance is relatively small i.e.
   // (stop - start) < counter_.dist, hence we simply
@@ -208,20 +227,9 @@ ALWAYS_INLINE uint64_t Sieve::count_arm_sve(uint64_t stop)
   if (start > stop)
     return count_;
 
-  // Quickly count the number of unsieved elements (in
-  // the sieve array) up to a value that is close to
-  // the stop number i.e. (stop - start) < counter_.dist.
-  // We do this using the counter array, each element
-  // of the counter array contains the number of
-  // unsieved elements in the interval:
-  // [i * counter_.dist, (i + 1) * counter_.dist[.
-  while (counter_.stop <= stop)
-  {
-    start = counter_.stop;
-    counter_.stop += counter_.dist;
-    counter_.sum += counter_[counter_.i++];
-    count_ = counter_.sum;
-  }
+  // Quickly count the number of unsieved elements
+  // up to a value that is close to the stop number.
+  start = count_counter(start, stop);
 
   // Here the remaining distance is relatively small i.e.
   // (stop - start) < counter_.dist, hence we simply
@@ -1,23 +1,27 @@
 ///
 /// @file  Sieve_pre_sieve.hpp
-/// @brief Pre-sieve the (primes and) multiples of primes ≤ 71.
-///        There are 7 static pre_sieved arrays in Sieve_arrays.hpp
-///        from which the primes and multiples of primes have
-///        been removed upfront. Each pre_sieved array corresponds
-///        to exactly two sieving primes:
+/// @brief Pre-sieve the (primes and) multiples of small primes.
+///        The pre_sieved arrays are generated at startup, these
+///        are sieve arrays from which the (primes and) multiples
+///        of a few small primes have been removed. The first
+///        pre_sieved array corresponds to the primes { 7, 11, 13 }
+///        and all other pre_sieved arrays correspond to exactly
+///        two sieving primes:
 ///
-///        pre_sieved_arrays[0] = { 17, 19 }
-///        pre_sieved_arrays[1] = { 23, 29 }
-///        pre_sieved_arrays[2] = { 31, 37 }
-///        pre_sieved_arrays[3] = { 41, 43 }
-///        pre_sieved_arrays[4] = { 47, 53 }
-///        pre_sieved_arrays[5] = { 59, 61 }
-///        pre_sieved_arrays[6] = { 67, 71 }
+///        pre_sieved_arrays[1]  = { 17, 19 }
+///        pre_sieved_arrays[2]  = { 23, 29 }
+///        ...
+///        pre_sieved_arrays[24] = { 241, 251 }
 ///
 ///        Pre-sieving consists of bitwise AND'ing the values of
-///        those 7 pre_sieved arrays and storing the result into the
-///        the sieve array. Pre-sieving speeds up the S2_hard and
-///        D algorithms by up to 5%.
+///        the pre_sieved arrays and storing the result into the
+///        sieve array. The pre_sieved arrays of the primes ≤ 71
+///        are always used, the larger pre_sieved arrays are only
+///        used if their period is not larger than the sieve
+///        array (otherwise they would mostly cause cache misses).
+///        Hence the number of pre-sieved primes increases with
+///        the segment size. Pre-sieving speeds up the S2_hard
+///        and D algorithms by up to 5%.
 ///
 /// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
 ///
@@ -29,47 +33,157 @@
 #define SIEVE_PRE_SIEVE_HPP
 
 #include <Sieve.hpp>
-#include "Sieve_arrays.hpp"
+#include <cpu_arch_macros.hpp>
+#include <macros.hpp>
 #include <Vector.hpp>
 
 #include <stdint.h>
 #include <algorithm>
 #include <cstring>
+#include <initializer_list>
+
+#if defined(ENABLE_AVX512_VPOPCNT)
+  #include <immintrin.h>
+#elif defined(ENABLE_MULTIARCH_AVX512_VPOPCNT)
+  #include <immintrin.h>
+  #include <cpu_supports_avx512_vpopcnt.hpp>
+#endif
 
 namespace {
 
-/// Removes the (primes and) multiples of
-/// primes ≤ 13 from the sieve array.
+struct PreSieved
+{
+  /// Number of bytes after which the
+  /// pre_sieved array repeats itself.
+  uint64_t period;
+  primecount::Vector<uint8_t> sieve;
+};
+
+/// The 8 bits of each byte of the sieve array correspond to
+/// the offsets { 1, 7, 11, 13, 17, 19, 23, 29 }. unset_bit[n % 30]
+/// unsets the bit corresponding to n, or no bit if n is not
+/// coprime to 30.
+///
+const primecount::Array<uint8_t, 30> unset_bit =
+{
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfd, 0xff, 0xff, 0xff, 0xfb,
+  0xff, 0xf7, 0xff, 0xff, 0xff, 0xef,
+  0xff, 0xdf, 0xff, 0xff, 0xff, 0xbf,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x7f
+};
+
+/// Each pre_sieved array (except the first one)
+/// corresponds to 2 consecutive sieving primes.
+///
+const primecount::Array<uint8_t, 48> pre_sieving_primes =
+{
+   17,  19,  23,  29,  31,  37,  41,  43,  47,  53,
+   59,  61,  67,  71,  73,  79,  83,  89,  97, 101,
+  103, 107, 109, 113, 127, 131, 137, 139, 149, 151,
+  157, 163, 167, 173, 179, 181, 191, 193, 197, 199,
+  211, 223, 227, 229, 233, 239, 241, 251
+};
+
+/// Remove the primes and multiples of primes from a
+/// sieve array whose size is a multiple of the product
+/// of the primes. For a smaller overhead when copying
+/// we use a pre_sieved array size of at least 4 KiB.
+///
+PreSieved generate_pre_sieved(std::initializer_list<uint64_t> primes)
+{
+  PreSieved pre_sieved;
+  pre_sieved.period = 1;
+
+  for (uint64_t prime : primes)
+    pre_sieved.period *= prime;
+
+  uint64_t bytes = pre_sieved.period;
+  while (bytes < 4096)
+    bytes += pre_sieved.period;
+
+  auto& sieve = pre_sieved.sieve;
+  sieve.resize(bytes);
+  std::fill(sieve.begin(), sieve.end(), 0xff);
+
+  // Cross off the odd multiples of each prime,
+  // n = i * 30 + rem without using divisions.
+  for (uint64_t prime : primes)
+  {
+    uint64_t i = prime / 30;
+    uint64_t rem = prime % 30;
+    uint64_t dist_bytes = (prime * 2) / 30;
+    uint64_t dist_rem = (prime * 2) % 30;
+
+    while (i < bytes)
+    {
+      sieve[i] &= unset_bit[rem];
+      i += dist_bytes;
+      rem += dist_rem;
+      if (rem >= 30)
+      {
+        rem -= 30;
+        i++;
+      }
+    }
+  }
+
+  return pre_sieved;
+}
+
+/// pre_sieved_arrays[0] = { 7, 11, 13 }
+/// pre_sieved_arrays[1] = { 17, 19 }
+/// ...
+/// pre_sieved_arrays[7] = { 67, 71 }
+///
+primecount::Vector<PreSieved> generate_small_pre_sieved_arrays()
+{
+  primecount::Vector<PreSieved> arrays;
+  arrays.reserve(8);
+  arrays.push_back(generate_pre_sieved({ 7, 11, 13 }));
+
+  for (std::size_t i = 0; i < 14; i += 2)
+    arrays.push_back(generate_pre_sieved({ pre_sieving_primes[i],
+                                           pre_sieving_primes[i + 1] }));
+  return arrays;
+}
+
+/// pre_sieved_arrays[8]  = { 73, 79 }
+/// ...
+/// pre_sieved_arrays[24] = { 241, 251 }
 ///
-void pre_sieve1(primecount::Vector<uint8_t>& sieve, uint64_t low)
+primecount::Vector<PreSieved> generate_large_pre_sieved_arrays()
 {
-  uint64_t prime_product = pre_sieved_13.size() * 30;
-  uint64_t i = (low % prime_product) / 30;
-  uint64_t bytes_to_copy = pre_sieved_13.size() - i;
-  const uint8_t* p = pre_sieved_13.begin();
+  primecount::Vector<PreSieved> arrays;
+  arrays.reserve(pre_sieving_primes.size() / 2 - 7);
 
-  if (sieve.size() <= bytes_to_copy)
-    std::copy_n(&p[i], sieve.size(), &sieve[0]);
+  for (std::size_t i = 14; i < pre_sieving_primes.size(); i += 2)
+    arrays.push_back(generate_pre_sieved({ pre_sieving_primes[i],
+                                           pre_sieving_primes[i + 1] }));
+  return arrays;
+}
+
+/// The pre_sieved arrays are generated only once (thread-safe)
+/// when they are used for the first time. Since the large
+/// pre_sieved arrays use about 500 KiB of memory we only
+/// generate these if the sieve array is large enough.
+///
+const PreSieved& pre_sieved_arrays(std::size_t i)
+{
+  static const auto small_arrays = generate_small_pre_sieved_arrays();
+
+  if (i < small_arrays.size())
+    return small_arrays[i];
   else
   {
-    // Copy the last remaining bytes to the
-    // beginning of the sieve array.
-    std::copy_n(&p[i], bytes_to_copy, &sieve[0]);
-
-    // Restart copying from the beginning
-    for (i = bytes_to_copy; 
-         i + pre_sieved_13.size() < sieve.size();
-         i += pre_sieved_13.size())
-      std::copy_n(p, pre_sieved_13.size(), &sieve[i]);
-
-    // Copy the last remaining bytes
-    std::copy_n(p, sieve.size() - i, &sieve[i]);
+    static const auto large_arrays = generate_large_pre_sieved_arrays();
+    return large_arrays[i - small_arrays.size()];
   }
 }
 
-void pre_sieve2(uint8_t* __restrict sieve,
-                const uint8_t* __restrict pre_sieved,
-                std::size_t bytes)
+void pre_sieve_default(uint8_t* __restrict sieve,
+                       const uint8_t* __restrict pre_sieved,
+                       std::size_t bytes)
 {
   constexpr std::size_t word_size = sizeof(unsigned long long);
   std::size_t limit = bytes - bytes % word_size;
@@ -77,7 +191,7 @@ void pre_sieve2(uint8_t* __restrict sieve,
   // Bitwise AND multiple bytes per iter.
   // std::memcpy is required to avoid unaligned
   // memory accesses. All major C++ compilers
-  // will optimize away std::memcpy. 
+  // will optimize away std::memcpy.
   for (std::size_t i = 0; i < limit; i += word_size)
   {
     unsigned long long a, b;
@@ -92,15 +206,93 @@ void pre_sieve2(uint8_t* __restrict sieve,
     sieve[i] &= pre_sieved[i];
 }
 
+#if defined(ENABLE_AVX512_VPOPCNT) || \
+    defined(ENABLE_MULTIARCH_AVX512_VPOPCNT)
+
+/// Bitwise AND 64 bytes per iteration. The remaining
+/// bytes are processed using pre_sieve_default() as
+/// the AVX512 masked byte loads require AVX512BW.
+///
+#if defined(ENABLE_MULTIARCH_AVX512_VPOPCNT)
+  __attribute__ ((target ("avx512f")))
+#endif
+void pre_sieve_avx512(uint8_t* __restrict sieve,
+                      const uint8_t* __restrict pre_sieved,
+                      std::size_t bytes)
+{
+  std::size_t limit = bytes - bytes % 64;
+
+  for (std::size_t i = 0; i < limit; i += 64)
+  {
+    __m512i a = _mm512_loadu_si512((const void*) &sieve[i]);
+    __m512i b = _mm512_loadu_si512((const void*) &pre_sieved[i]);
+    _mm512_storeu_si512((void*) &sieve[i], _mm512_and_si512(a, b));
+  }
+
+  pre_sieve_default(&sieve[limit], &pre_sieved[limit], bytes - limit);
+}
+
+#endif
+
+/// sieve[i] &= pre_sieved[i]
+void pre_sieve_and(uint8_t* __restrict sieve,
+                   const uint8_t* __restrict pre_sieved,
+                   std::size_t bytes)
+{
+  #if defined(ENABLE_AVX512_VPOPCNT)
+    pre_sieve_avx512(sieve, pre_sieved, bytes);
+  #elif defined(ENABLE_MULTIARCH_AVX512_VPOPCNT)
+    if (cpu_supports_avx512_vpopcnt)
+      pre_sieve_avx512(sieve, pre_sieved, bytes);
+    else
+      pre_sieve_default(sieve, pre_sieved, bytes);
+  #else
+    pre_sieve_default(sieve, pre_sieved, bytes);
+  #endif
+}
+
+/// Copy (or bitwise AND) the pre_sieved array
+/// periodically into the sieve array.
+///
+template <bool IS_COPY>
+void pre_sieve(primecount::Vector<uint8_t>& sieve,
+               const PreSieved& pre_sieved,
+               uint64_t low)
+{
+  const uint8_t* p = pre_sieved.sieve.data();
+  uint64_t size = pre_sieved.sieve.size();
+  uint64_t pos = (low / 30) % pre_sieved.period;
+  uint64_t offset = 0;
+
+  while (offset < sieve.size())
+  {
+    uint64_t bytes = sieve.size() - offset;
+    bytes = std::min(bytes, size - pos);
+
+    if (IS_COPY)
+      std::copy_n(&p[pos], bytes, &sieve[offset]);
+    else
+      pre_sieve_and(&sieve[offset], &p[pos], bytes);
+
+    offset += bytes;
+    pos += bytes;
+    pos *= pos < size;
+  }
+}
+
 } // namespace
 
 namespace primecount {
 
-/// Removes the (primes and) multiples of
-/// primes ≤ 71 from the sieve array.
+/// Removes the (primes and) multiples of the primes ≤ primes[c]
+/// that are contained in the pre_sieved arrays from the sieve
+/// array. The remaining primes must be crossed off afterwards.
+/// @return PrimePi of the largest pre-sieved prime
 ///
 uint64_t Sieve::pre_sieve(uint64_t c, uint64_t low)
 {
+  ASSERT(low % 30 == 0);
+
   // PrimePi(5) = 3
   uint64_t primePi = 3;
 
@@ -110,34 +302,23 @@ uint64_t Sieve::pre_sieve(uint64_t c, uint64_t low)
   {
     // PrimePi(13) = 6
     primePi = 6;
-    pre_sieve1(sieve_, low);
+    ::pre_sieve<true>(sieve_, pre_sieved_arrays(0), low);
 
-    for (const auto& pre_sieved : pre_sieved_arrays)
+    // Each pre_sieved array (except the first one)
+    // contains exactly 2 sieving primes.
+    for (std::size_t i = 1; i <= pre_sieving_primes.size() / 2; i++)
     {
-      // Each pre_sieved_arrays[i] contains
-      // exactly 2 sieving primes > 13.
-      if (c >= primePi + 2)
-        primePi += 2;
-      else
-        return primePi;
-
-      const uint8_t* p = pre_sieved.begin();
-      uint64_t prime_product = pre_sieved.size() * 30;
-      uint64_t pos = (low % prime_product) / 30;
-      uint64_t offset = 0;
-
-      while (offset < sieve_.size())
-      {
-        uint64_t bytes_to_copy = sieve_.size() - offset;
-        uint64_t bytes_to_copy2 = uint64_t(pre_sieved.size() - pos);
-        bytes_to_copy = std::min(bytes_to_copy, bytes_to_copy2);
+      uint64_t prime1 = pre_sieving_primes[i * 2 - 2];
+      uint64_t prime2 = pre_sieving_primes[i * 2 - 1];
 
-        pre_sieve2(&sieve_[offset], &p[pos], bytes_to_copy);
+      // Large pre_sieved arrays (primes > 71) are only
+      // used if their period fits into the sieve array.
+      if (c < primePi + 2 ||
+          (prime1 > 71 && prime1 * prime2 > sieve_.size()))
+        break;
 
-        offset += bytes_to_copy;
-        pos += bytes_to_copy;
-        pos *= pos < pre_sieved.size();
-      }
+      primePi += 2;
+      ::pre_sieve<false>(sieve_, pre_sieved_arrays(i), low);
     }
   }
 
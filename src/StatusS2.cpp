@@ -11,6 +11,7 @@
 ///
 
 #include <StatusS2.hpp>
+#include <context.hpp>
 #include <primecount-internal.hpp>
 #include <int128_t.hpp>
 
@@ -52,7 +53,8 @@ double skewed_percent(T x, T y)
 
 namespace primecount {
 
-StatusS2::StatusS2(maxint_t x)
+StatusS2::StatusS2(maxint_t x) :
+  out_(&get_print_stream())
 {
   precision_ = get_status_precision(x);
   epsilon_ = 1.0;
@@ -86,6 +88,12 @@ double StatusS2::getPercent(int64_t low, int64_t limit, maxint_t sum, maxint_t s
   return percent;
 }
 
+/// Used by S2_easy
+double StatusS2::getPercent(int64_t b, int64_t max_b)
+{
+  return skewed_percent(b, max_b);
+}
+
 void StatusS2::print(double percent)
 {
   double old = percent_;
@@ -95,7 +103,7 @@ void StatusS2::print(double percent)
     percent_ = percent;
     std::ostringstream status;
     status << "\rStatus: " << std::fixed << std::setprecision(precision_) << percent << '%';
-    std::cout << status.str() << std::flush;
+    *out_ << status.str() << std::flush;
   }
 }
 
@@ -130,7 +138,7 @@ void StatusS2::print(int64_t b, int64_t max_b)
   if ((time - old) >= threshold_)
   {
     time_ = time;
-    double percent = skewed_percent(b, max_b);
+    double percent = getPercent(b, max_b);
     print(percent);
   }
 }
@@ -11,6 +11,7 @@
 #define STATUSS2_HPP
 
 #include <int128_t.hpp>
+#include <iosfwd>
 
 namespace primecount {
 
@@ -21,6 +22,7 @@ public:
   void print(int64_t b, int64_t max_b);
   void print(int64_t low, int64_t limit, maxint_t sum, maxint_t sum_approx);
   static double getPercent(int64_t low, int64_t limit, maxint_t sum, maxint_t sum_approx);
+  static double getPercent(int64_t b, int64_t max_b);
 private:
   void print(double percent);
   double epsilon_ = 0;
@@ -30,6 +32,7 @@ private:
   // since last printing the status.
   double threshold_ = 0.1;
   int precision_ = 0;
+  std::ostream* out_;
 };
 
 } // namespace
@@ -0,0 +1,133 @@
+///
+/// @file  ThreadLease.cpp
+/// @brief Library wide budget of threads that is shared by all
+///        pi(x) computations running at the same time.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <ThreadLease.hpp>
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+namespace {
+
+std::mutex mutex;
+
+/// Number of threads currently leased by all threads
+int leased_threads = 0;
+
+/// Lease of the current thread
+thread_local const primecount::ThreadLease* current_lease = nullptr;
+
+} // namespace
+
+namespace primecount {
+
+ThreadLease::ThreadLease(int threads) :
+  old_lease_(current_lease)
+{
+  threads = std::max(1, threads);
+
+#ifdef _OPENMP
+  // Nested parallel regions are run using the
+  // thread of the enclosing parallel region.
+  if (omp_in_parallel())
+  {
+    threads_ = threads;
+    return;
+  }
+#endif
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (current_lease)
+  {
+    // The enclosing lease may have returned
+    // some of its threads in the meantime.
+    root_ = current_lease->root_;
+    int root_threads = root_ ? root_->leased_ : current_lease->threads_;
+    threads_ = in_between(1, root_threads, threads);
+    current_lease = this;
+    return;
+  }
+
+  int available = max_threads() - leased_threads;
+  threads_ = in_between(1, available, threads);
+  leased_ = threads_;
+  leased_threads += leased_;
+  root_ = this;
+  current_lease = this;
+}
+
+ThreadLease::~ThreadLease()
+{
+  current_lease = old_lease_;
+
+  if (root_ == this)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    leased_threads -= leased_;
+  }
+}
+
+/// The budget is only oversubscribed if a computation has
+/// started while all threads were in use. The threads that
+/// are returned are not handed out to a running parallel
+/// region (an OpenMP team cannot grow), they are available
+/// to the next parallel region of any computation.
+///
+bool ThreadLease::release_thread() const
+{
+  if (!root_)
+    return false;
+
+#ifdef _OPENMP
+  // The master thread finishes the remaining work
+  if (omp_get_thread_num() == 0)
+    return false;
+#endif
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (root_->leased_ > 1 &&
+      leased_threads > max_threads())
+  {
+    root_->leased_--;
+    leased_threads--;
+    return true;
+  }
+
+  return false;
+}
+
+const ThreadLease* ThreadLease::get_current()
+{
+  return current_lease;
+}
+
+/// All computations share the same budget as the pi_async()
+/// jobs, by default this is the number of CPU cores.
+///
+int ThreadLease::max_threads()
+{
+  return std::max(1, get_num_threads());
+}
+
+int ThreadLease::available_threads()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return std::max(0, max_threads() - leased_threads);
+}
+
+} // namespace
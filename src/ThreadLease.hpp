@@ -0,0 +1,72 @@
+///
+/// @file  ThreadLease.hpp
+/// @brief Library wide budget of get_num_threads() threads that
+///        is shared by all pi(x) computations running at the
+///        same time (including the pi_async() jobs). Each
+///        OpenMP parallel region leases its threads from the
+///        budget before it starts and returns them once it has
+///        finished. If other computations currently use some of
+///        the threads, the parallel region is run using fewer
+///        threads, this way concurrent pi(x) computations do not
+///        oversubscribe the CPU cores. A lease never waits,
+///        if no threads are available the parallel region is
+///        run using a single thread.
+///
+///        A parallel region whose thread already holds a lease
+///        (e.g. the PiTable that is initialized by the D formula)
+///        is limited to the threads of the enclosing lease.
+///
+///        While the budget is oversubscribed the threads of a
+///        running parallel region return themselves to the
+///        budget at the next work unit boundary, see
+///        release_thread().
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef THREADLEASE_HPP
+#define THREADLEASE_HPP
+
+namespace primecount {
+
+class ThreadLease
+{
+public:
+  ThreadLease(int threads);
+  ~ThreadLease();
+  ThreadLease(const ThreadLease&) = delete;
+  ThreadLease& operator=(const ThreadLease&) = delete;
+
+  /// Number of threads of the parallel region
+  int threads() const { return threads_; }
+
+  /// Called by a thread of the parallel region when it has
+  /// finished a work unit. Returns true if the thread has
+  /// been returned to the budget, the thread must then stop
+  /// processing work units. The master thread of the
+  /// parallel region is never returned.
+  ///
+  bool release_thread() const;
+
+  /// Lease of the current thread or nullptr
+  static const ThreadLease* get_current();
+
+  /// Size of the budget, i.e. get_num_threads()
+  static int max_threads();
+
+  /// Threads that are currently not leased
+  static int available_threads();
+
+private:
+  int threads_ = 1;
+  mutable int leased_ = 0;
+  const ThreadLease* root_ = nullptr;
+  const ThreadLease* old_lease_ = nullptr;
+};
+
+} // namespace
+
+#endif
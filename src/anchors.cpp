@@ -0,0 +1,239 @@
+///
+/// @file  anchors.cpp
+/// @brief Anchors are known values of pi(x). If x is close to an
+///        anchor we compute pi(x) = pi(anchor) +- the number of
+///        primes between the anchor and x, the primes are
+///        counted using a segmented sieve of Eratosthenes (see
+///        count_primes()). This is much faster than computing
+///        pi(x) from scratch if the distance is small, see
+///        max_sieve_distance().
+///
+///        The anchors consist of the built-in values of pi(10^k)
+///        and pi(2^k), the anchors added by the user (e.g. from
+///        a file) and the results of previous pi(x) computations.
+///        Anchors are disabled by default, they are enabled
+///        using set_anchors(true).
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <cancel.hpp>
+#include <int128_t.hpp>
+#include <print.hpp>
+
+#include <stdint.h>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+namespace {
+
+/// pi(10^k) for k = 1, 2, ..., 18
+const int64_t pi_pow10[] =
+{
+  4ll, 25ll, 168ll, 1229ll, 9592ll, 78498ll, 664579ll,
+  5761455ll, 50847534ll, 455052511ll, 4118054813ll,
+  37607912018ll, 346065536839ll, 3204941750802ll,
+  29844570422669ll, 279238341033925ll, 2623557157654233ll,
+  24739954287740860ll
+};
+
+/// pi(2^k) for k = 1, 2, ..., 62
+const int64_t pi_pow2[] =
+{
+  1ll, 2ll, 4ll, 6ll, 11ll, 18ll, 31ll, 54ll, 97ll, 172ll, 309ll,
+  564ll, 1028ll, 1900ll, 3512ll, 6542ll, 12251ll, 23000ll,
+  43390ll, 82025ll, 155611ll, 295947ll, 564163ll, 1077871ll,
+  2063689ll, 3957809ll, 7603553ll, 14630843ll, 28192750ll,
+  54400028ll, 105097565ll, 203280221ll, 393615806ll, 762939111ll,
+  1480206279ll, 2874398515ll, 5586502348ll, 10866266172ll,
+  21151907950ll, 41203088796ll, 80316571436ll, 156661034233ll,
+  305761713237ll, 597116381732ll, 1166746786182ll,
+  2280998753949ll, 4461632979717ll, 8731188863470ll,
+  17094432576778ll, 33483379603407ll, 65612899915304ll,
+  128625503610475ll, 252252704148404ll, 494890204904784ll,
+  971269945245201ll, 1906879381028850ll, 3745011184713964ll,
+  7357400267843990ll, 14458792895301660ll, 28423094496953330ll,
+  55890484045084135ll, 109932807585469973ll
+};
+
+/// The results of previous computations are
+/// only stored if there are fewer anchors.
+const std::size_t max_anchors = 1 << 16;
+
+std::mutex anchors_mutex;
+std::map<int64_t, int64_t> anchors;
+bool is_anchors = false;
+
+void init_anchors()
+{
+  if (!anchors.empty())
+    return;
+
+  int64_t x = 1;
+  for (int64_t pix : pi_pow10)
+  {
+    x *= 10;
+    anchors[x] = pix;
+  }
+
+  x = 1;
+  for (int64_t pix : pi_pow2)
+  {
+    x *= 2;
+    anchors[x] = pix;
+  }
+}
+
+} // namespace
+
+namespace primecount {
+
+void set_anchors(bool enable)
+{
+  std::lock_guard<std::mutex> lock(anchors_mutex);
+  init_anchors();
+  is_anchors = enable;
+}
+
+/// The anchors are not verified, an incorrect
+/// anchor causes incorrect pi(x) results.
+///
+void add_anchor(int64_t x, int64_t pix)
+{
+  if (x < 0 || pix < 0 || pix > x)
+    throw primecount_error("add_anchor(x, pix): invalid anchor pi(" +
+        std::to_string(x) + ") = " + std::to_string(pix));
+
+  std::lock_guard<std::mutex> lock(anchors_mutex);
+  init_anchors();
+  anchors[x] = pix;
+}
+
+/// File format: one anchor per line, x followed by pi(x).
+/// x may be an integer expression e.g. 10^15. Empty lines
+/// and lines starting with '#' are ignored.
+///
+void load_anchors(const std::string& filename)
+{
+  std::ifstream file(filename);
+  if (!file)
+    throw primecount_error("failed to open '" + filename + "'");
+
+  std::string str;
+  int64_t line = 0;
+
+  while (std::getline(file, str))
+  {
+    line++;
+    std::istringstream iss(str);
+    std::string x;
+    std::string pix;
+
+    if (!(iss >> x) || x[0] == '#')
+      continue;
+
+    try
+    {
+      if (!(iss >> pix))
+        throw primecount_error("missing pi(x)");
+      maxint_t n = to_maxint(x);
+      if (n > pstd::numeric_limits<int64_t>::max())
+        throw primecount_error("x must be < 2^63");
+      add_anchor((int64_t) n, (int64_t) to_maxint(pix));
+    }
+    catch (const std::exception& e)
+    {
+      throw primecount_error(filename + ":" + std::to_string(line) + ": " + e.what());
+    }
+  }
+}
+
+/// Store the result of a pi(x) computation, so
+/// that it can be used as an anchor later. The result
+/// of a cancelled computation may be incorrect.
+///
+void add_result_anchor(int64_t x, int64_t pix)
+{
+  if (is_cancelled(get_cancel_token()))
+    return;
+
+  std::lock_guard<std::mutex> lock(anchors_mutex);
+  if (is_anchors && anchors.size() < max_anchors)
+    anchors[x] = pix;
+}
+
+/// Compute pi(x) using the nearest anchor.
+/// Returns -1 if anchors are disabled or if
+/// there is no anchor close to x.
+///
+int64_t pi_anchor(int64_t x, int threads, bool is_print)
+{
+  int64_t max_dist = max_sieve_distance(x);
+  int64_t anchor = -1;
+  int64_t pix_anchor = -1;
+
+  {
+    std::lock_guard<std::mutex> lock(anchors_mutex);
+    if (!is_anchors)
+      return -1;
+
+    // Find the nearest anchor
+    auto iter = anchors.lower_bound(x);
+    if (iter != anchors.end())
+    {
+      anchor = iter->first;
+      pix_anchor = iter->second;
+    }
+    if (iter != anchors.begin())
+    {
+      auto prev = std::prev(iter);
+      if (anchor < 0 || x - prev->first < anchor - x)
+      {
+        anchor = prev->first;
+        pix_anchor = prev->second;
+      }
+    }
+  }
+
+  if (anchor < 0 ||
+      (anchor > x && anchor - x > max_dist) ||
+      (anchor < x && x - anchor > max_dist))
+    return -1;
+
+  double time;
+
+  if (is_print)
+  {
+    print("");
+    print("=== pi_anchor(x) ===");
+    print("x", x);
+    print("anchor", anchor);
+    print("pi(anchor)", pix_anchor);
+    print("threads", threads);
+    time = get_time();
+  }
+
+  int64_t pix = pix_anchor;
+
+  if (anchor < x)
+    pix += count_primes(anchor + 1, x, threads);
+  if (anchor > x)
+    pix -= count_primes(x + 1, anchor, threads);
+
+  if (is_print)
+    print("pi(x)", pix, time);
+
+  return pix;
+}
+
+} // namespace
@@ -10,15 +10,19 @@
 
 #include <primecount.hpp>
 #include <primecount-internal.hpp>
+#include <cancel.hpp>
+#include <context.hpp>
 #include <primesieve.hpp>
 #include <gourdon.hpp>
 #include <int128_t.hpp>
 #include <macros.hpp>
 #include <PiTable.hpp>
 #include <print.hpp>
+#include <Progress.hpp>
 
 #include <cmath>
 #include <string>
+#include <vector>
 #include <stdint.h>
 
 #ifdef _OPENMP
@@ -52,6 +56,80 @@ int64_t pi(int64_t x)
   return pi(x, get_num_threads());
 }
 
+/// If the computation has been cancelled while running, some
+/// of its formulas may have stopped early and returned a
+/// partial result. Hence we must check the token again after
+/// the computation has finished.
+///
+int64_t pi(int64_t x, const cancel_token& token)
+{
+  CancelScope cancelScope(&token);
+  check_cancelled();
+  int64_t res = pi(x);
+  check_cancelled();
+  return res;
+}
+
+std::string pi(const std::string& x, const cancel_token& token)
+{
+  CancelScope cancelScope(&token);
+  check_cancelled();
+  std::string res = pi(x);
+  check_cancelled();
+  return res;
+}
+
+int64_t pi(int64_t x, const context& ctx)
+{
+  ContextScope contextScope(&ctx);
+  check_cancelled();
+  int64_t res = pi(x, get_num_threads(ctx, x));
+  check_cancelled();
+  return res;
+}
+
+std::string pi(const std::string& x, const context& ctx)
+{
+  ContextScope contextScope(&ctx);
+  check_cancelled();
+  maxint_t n = to_maxint(x);
+  maxint_t res = pi(n, get_num_threads(ctx, n));
+  check_cancelled();
+  return to_string(res);
+}
+
+int64_t pi_range(int64_t a, int64_t b)
+{
+  return (int64_t) pi_range(a, b, get_num_threads());
+}
+
+std::string pi_range(const std::string& a, const std::string& b)
+{
+  maxint_t res = pi_range(to_maxint(a), to_maxint(b), get_num_threads());
+  return to_string(res);
+}
+
+int64_t pi_range(int64_t a, int64_t b, const context& ctx)
+{
+  ContextScope contextScope(&ctx);
+  check_cancelled();
+  int64_t res = (int64_t) pi_range(a, b, get_num_threads(ctx, b));
+  check_cancelled();
+  return res;
+}
+
+std::string pi_range(const std::string& a,
+                     const std::string& b,
+                     const context& ctx)
+{
+  ContextScope contextScope(&ctx);
+  check_cancelled();
+  maxint_t n = to_maxint(b);
+  maxint_t res = pi_range(to_maxint(a), n, get_num_threads(ctx, n));
+  check_cancelled();
+  return to_string(res);
+}
+
 pc_int128_t pi(pc_int128_t x)
 {
   if (x.hi < 0)
@@ -89,6 +167,11 @@ int64_t pi(int64_t x, int threads)
   if (x <= PiTable::max_cached())
     return pi_cache(x);
 
+  // Lookup pi(x) in the pi table file (if loaded)
+  int64_t res = pi_table_file(x);
+  if (res >= 0)
+    return res;
+
   // For ]10^4, 10^5] Legendre's algorithm runs fastest
   if (x <= (int64_t) 1e5)
     return pi_legendre(x, threads);
@@ -97,14 +180,22 @@ int64_t pi(int64_t x, int threads)
   if (x <= (int64_t) 1e8)
     return pi_meissel(x, threads);
 
+  // Use a nearby known value of pi(x)
+  res = pi_anchor(x, threads);
+  if (res >= 0)
+    return res;
+
   // For large x Gourdon's algorithm runs fastest
-  return pi_gourdon_64(x, threads);
+  res = pi_gourdon_64(x, threads);
+  add_result_anchor(x, res);
+  return res;
 }
 
 /// Used internally for initialization
 int64_t pi_noprint(int64_t x, int threads)
 {
   bool is_print = false;
+  ProgressDisabled progressDisabled;
 
   if (x <= PiTable::max_cached())
     return pi_cache(x, is_print);
@@ -148,11 +239,40 @@ int64_t nth_prime(int64_t n)
   return nth_prime(n, get_num_threads());
 }
 
+int64_t nth_prime(int64_t n, const cancel_token& token)
+{
+  CancelScope cancelScope(&token);
+  check_cancelled();
+  int64_t res = nth_prime(n);
+  check_cancelled();
+  return res;
+}
+
+/// The memory usage of nth_prime(n) is dominated
+/// by the pi(x) computation with x ~ nth_prime(n).
+///
+int64_t nth_prime(int64_t n, const context& ctx)
+{
+  ContextScope contextScope(&ctx);
+  check_cancelled();
+  int64_t x = (n > 0) ? RiemannR_inverse(n) : 0;
+  int64_t res = nth_prime(n, get_num_threads(ctx, x));
+  check_cancelled();
+  return res;
+}
+
 int64_t nth_prime(int64_t n, int threads)
 {
   return nth_prime_64(n, threads);
 }
 
+std::vector<int64_t> nth_prime(const std::vector<int64_t>& n)
+{
+  std::vector<int64_t> res(n.size());
+  nth_prime_64(n.data(), res.data(), n.size(), get_num_threads());
+  return res;
+}
+
 pc_int128_t nth_prime(pc_int128_t n)
 {
   // n < 1
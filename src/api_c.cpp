@@ -10,6 +10,7 @@
 
 #include <primecount.h>
 #include <primecount.hpp>
+#include <primecount-internal.hpp>
 #include <int128_t.hpp>
 
 #include <stdint.h>
@@ -17,8 +18,112 @@
 #include <sstream>
 #include <string>
 #include <exception>
+#include <functional>
 #include <iostream>
 
+/// The C API's opaque cancellation token
+struct primecount_cancel_token
+{
+  primecount::cancel_token token;
+};
+
+/// The C API's opaque computation settings
+struct primecount_ctx
+{
+  primecount::context ctx;
+};
+
+/// The C API's opaque asynchronous computation handle
+struct primecount_async
+{
+  primecount::async_result result;
+};
+
+namespace {
+
+/// Copy the result string into the user's res buffer
+int copy_result(const std::string& pix, char* res, size_t len)
+{
+  // +1 required to add null at the end of the string
+  if (len < pix.length() + 1)
+  {
+    std::ostringstream oss;
+    oss << "res buffer too small, res.len = " << len << " < required = " << pix.length() + 1;
+    throw primecount::primecount_error(oss.str());
+  }
+
+  pix.copy(res, pix.length());
+  // std::string::copy does not append a null character
+  // at the end of the copied content.
+  res[pix.length()] = '\0';
+
+  return (int) pix.length();
+}
+
+/// Convert the C progress callback to a C++ callback,
+/// returns an empty std::function if callback is NULL.
+///
+std::function<void(const primecount::pc_progress_t&)>
+to_progress_callback(primecount_progress_callback_t callback, void* data)
+{
+  if (!callback)
+    return nullptr;
+
+  return [callback, data](const primecount::pc_progress_t& p)
+  {
+    pc_progress_t progress;
+    progress.formula = p.formula;
+    progress.percent = p.percent;
+    progress.seconds = p.seconds;
+    progress.sum.lo = p.sum.lo;
+    progress.sum.hi = p.sum.hi;
+    callback(&progress, data);
+  };
+}
+
+/// Convert the C options to C++ options
+primecount::async_options to_async_options(const primecount_async_options* opts)
+{
+  primecount::async_options options;
+
+  if (!opts)
+    return options;
+
+  options.threads = opts->threads;
+  options.timeout = opts->timeout;
+  void* data = opts->data;
+
+  if (opts->progress)
+  {
+    options.progress = to_progress_callback(opts->progress, data);
+  }
+
+  if (opts->completion)
+  {
+    primecount_completion_callback_t callback = opts->completion;
+    options.completion = [callback, data](const primecount::async_result& result)
+    {
+      try
+      {
+        std::string res = result.get();
+        callback(res.c_str(), 0, data);
+      }
+      catch (const primecount::primecount_cancelled&)
+      {
+        callback(nullptr, -2, data);
+      }
+      catch (const std::exception&)
+      {
+        callback(nullptr, -1, data);
+      }
+    };
+  }
+
+  return options;
+}
+
+} // namespace
+
 int64_t primecount_pi(int64_t x)
 {
   try
@@ -70,25 +175,66 @@ int primecount_pi_str(const char* x, char* res, size_t len)
 
     std::string str(x);
     std::string pix = primecount::pi(str);
+    return copy_result(pix, res, len);
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_pi_str: " << e.what() << std::endl;
 
-    // +1 required to add null at the end of the string
-    if (len < pix.length() + 1)
-    {
-      std::ostringstream oss;
-      oss << "res buffer too small, res.len = " << len << " < required = " << pix.length() + 1;
-      throw primecount::primecount_error(oss.str());
-    }
+    if (res && len > 0)
+      res[0] = '\0';
 
-    pix.copy(res, pix.length());
-    // std::string::copy does not append a null character
-    // at the end of the copied content.
-    res[pix.length()] = '\0';
+    return -1;
+  }
+}
+
+int64_t primecount_pi_cancellable(int64_t x, primecount_cancel_token* token)
+{
+  try
+  {
+    if (!token)
+      throw primecount::primecount_error("token must not be a NULL pointer");
 
-    return (int) pix.length();
+    return primecount::pi(x, token->token);
+  }
+  catch(const primecount::primecount_cancelled&)
+  {
+    return -2;
   }
   catch(const std::exception& e)
   {
-    std::cerr << "primecount_pi_str: " << e.what() << std::endl;
+    std::cerr << "primecount_pi_cancellable: " << e.what() << std::endl;
+    return -1;
+  }
+}
+
+int primecount_pi_str_cancellable(const char* x, char* res, size_t len, primecount_cancel_token* token)
+{
+  try
+  {
+    if (!x)
+      throw primecount::primecount_error("x must not be a NULL pointer");
+
+    if (!res)
+      throw primecount::primecount_error("res must not be a NULL pointer");
+
+    if (!token)
+      throw primecount::primecount_error("token must not be a NULL pointer");
+
+    std::string str(x);
+    std::string pix = primecount::pi(str, token->token);
+    return copy_result(pix, res, len);
+  }
+  catch(const primecount::primecount_cancelled&)
+  {
+    if (res && len > 0)
+      res[0] = '\0';
+
+    return -2;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_pi_str_cancellable: " << e.what() << std::endl;
 
     if (res && len > 0)
       res[0] = '\0';
@@ -110,6 +256,23 @@ int64_t primecount_nth_prime(int64_t n)
   }
 }
 
+int primecount_nth_prime_array(const int64_t* n, int64_t* res, size_t size)
+{
+  try
+  {
+    if (size > 0 && (!n || !res))
+      throw primecount::primecount_error("n and res must not be NULL pointers");
+
+    primecount::nth_prime_64(n, res, size, primecount::get_num_threads());
+    return 0;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_nth_prime_array: " << e.what() << std::endl;
+    return -1;
+  }
+}
+
 pc_int128_t primecount_nth_prime_128(pc_int128_t n)
 {
   try
@@ -136,6 +299,43 @@ pc_int128_t primecount_nth_prime_128(pc_int128_t n)
   }
 }
 
+int64_t primecount_pi_range(int64_t a, int64_t b)
+{
+  try
+  {
+    return primecount::pi_range(a, b);
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_pi_range: " << e.what() << std::endl;
+    return -1;
+  }
+}
+
+int primecount_pi_range_str(const char* a, const char* b, char* res, size_t len)
+{
+  try
+  {
+    if (!a || !b)
+      throw primecount::primecount_error("a and b must not be NULL pointers");
+
+    if (!res)
+      throw primecount::primecount_error("res must not be a NULL pointer");
+
+    std::string pi_ab = primecount::pi_range(std::string(a), std::string(b));
+    return copy_result(pi_ab, res, len);
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_pi_range_str: " << e.what() << std::endl;
+
+    if (res && len > 0)
+      res[0] = '\0';
+
+    return -1;
+  }
+}
+
 int64_t primecount_phi(int64_t x, int64_t a)
 {
   try
@@ -186,6 +386,344 @@ void primecount_set_verify_computation(bool enable)
   }
 }
 
+void primecount_set_progress_callback(primecount_progress_callback_t callback, void* data)
+{
+  try
+  {
+    primecount::set_progress_callback(to_progress_callback(callback, data));
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_set_progress_callback: " << e.what() << std::endl;
+  }
+}
+
+void primecount_set_anchors(bool enable)
+{
+  try
+  {
+    primecount::set_anchors(enable);
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_set_anchors: " << e.what() << std::endl;
+  }
+}
+
+int primecount_add_anchor(int64_t x, int64_t pix)
+{
+  try
+  {
+    primecount::add_anchor(x, pix);
+    return 0;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_add_anchor: " << e.what() << std::endl;
+    return -1;
+  }
+}
+
+int primecount_load_anchors(const char* filename)
+{
+  try
+  {
+    if (!filename)
+      throw primecount::primecount_error("filename must not be a NULL pointer");
+    primecount::load_anchors(filename);
+    return 0;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_load_anchors: " << e.what() << std::endl;
+    return -1;
+  }
+}
+
+int primecount_generate_pi_table(const char* filename, int64_t max_x)
+{
+  try
+  {
+    if (!filename)
+      throw primecount::primecount_error("filename must not be a NULL pointer");
+    primecount::generate_pi_table(filename, max_x);
+    return 0;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_generate_pi_table: " << e.what() << std::endl;
+    return -1;
+  }
+}
+
+int primecount_load_pi_table(const char* filename)
+{
+  try
+  {
+    if (!filename)
+      throw primecount::primecount_error("filename must not be a NULL pointer");
+    primecount::load_pi_table(filename);
+    return 0;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_load_pi_table: " << e.what() << std::endl;
+    return -1;
+  }
+}
+
+primecount_cancel_token* primecount_cancel_token_create(void)
+{
+  try
+  {
+    return new primecount_cancel_token;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_cancel_token_create: " << e.what() << std::endl;
+    return nullptr;
+  }
+}
+
+void primecount_cancel_token_destroy(primecount_cancel_token* token)
+{
+  delete token;
+}
+
+void primecount_cancel(primecount_cancel_token* token)
+{
+  if (token)
+    token->token.cancel();
+}
+
+void primecount_cancel_after(primecount_cancel_token* token, double seconds)
+{
+  if (token)
+    token->token.set_timeout(seconds);
+}
+
+primecount_ctx* primecount_ctx_create(void)
+{
+  try
+  {
+    return new primecount_ctx;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_ctx_create: " << e.what() << std::endl;
+    return nullptr;
+  }
+}
+
+void primecount_ctx_destroy(primecount_ctx* ctx)
+{
+  delete ctx;
+}
+
+void primecount_ctx_set_num_threads(primecount_ctx* ctx, int threads)
+{
+  if (ctx)
+    ctx->ctx.threads = threads;
+}
+
+void primecount_ctx_set_alpha(primecount_ctx* ctx, double alpha)
+{
+  if (ctx)
+    ctx->ctx.alpha = alpha;
+}
+
+void primecount_ctx_set_alpha_y(primecount_ctx* ctx, double alpha_y)
+{
+  if (ctx)
+    ctx->ctx.alpha_y = alpha_y;
+}
+
+void primecount_ctx_set_alpha_z(primecount_ctx* ctx, double alpha_z)
+{
+  if (ctx)
+    ctx->ctx.alpha_z = alpha_z;
+}
+
+void primecount_ctx_set_max_memory(primecount_ctx* ctx, uint64_t bytes)
+{
+  if (ctx)
+    ctx->ctx.max_memory = bytes;
+}
+
+void primecount_ctx_set_print(primecount_ctx* ctx, int print)
+{
+  if (ctx)
+    ctx->ctx.print = (print != 0);
+}
+
+void primecount_ctx_set_progress_callback(primecount_ctx* ctx, primecount_progress_callback_t callback, void* data)
+{
+  if (ctx)
+    ctx->ctx.progress = to_progress_callback(callback, data);
+}
+
+void primecount_ctx_set_cancel_token(primecount_ctx* ctx, primecount_cancel_token* token)
+{
+  if (ctx)
+    ctx->ctx.cancel = (token) ? &token->token : nullptr;
+}
+
+int64_t primecount_ctx_pi(primecount_ctx* ctx, int64_t x)
+{
+  try
+  {
+    if (!ctx)
+      throw primecount::primecount_error("ctx must not be a NULL pointer");
+
+    return primecount::pi(x, ctx->ctx);
+  }
+  catch(const primecount::primecount_cancelled&)
+  {
+    return -2;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_ctx_pi: " << e.what() << std::endl;
+    return -1;
+  }
+}
+
+int primecount_ctx_pi_str(primecount_ctx* ctx, const char* x, char* res, size_t len)
+{
+  try
+  {
+    if (!ctx)
+      throw primecount::primecount_error("ctx must not be a NULL pointer");
+
+    if (!x)
+      throw primecount::primecount_error("x must not be a NULL pointer");
+
+    if (!res)
+      throw primecount::primecount_error("res must not be a NULL pointer");
+
+    std::string str(x);
+    std::string pix = primecount::pi(str, ctx->ctx);
+    return copy_result(pix, res, len);
+  }
+  catch(const primecount::primecount_cancelled&)
+  {
+    if (res && len > 0)
+      res[0] = '\0';
+
+    return -2;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_ctx_pi_str: " << e.what() << std::endl;
+
+    if (res && len > 0)
+      res[0] = '\0';
+
+    return -1;
+  }
+}
+
+int64_t primecount_ctx_nth_prime(primecount_ctx* ctx, int64_t n)
+{
+  try
+  {
+    if (!ctx)
+      throw primecount::primecount_error("ctx must not be a NULL pointer");
+
+    return primecount::nth_prime(n, ctx->ctx);
+  }
+  catch(const primecount::primecount_cancelled&)
+  {
+    return -2;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_ctx_nth_prime: " << e.what() << std::endl;
+    return -1;
+  }
+}
+
+primecount_async* primecount_pi_async(const char* x, const primecount_async_options* options)
+{
+  try
+  {
+    if (!x)
+      throw primecount::primecount_error("x must not be a NULL pointer");
+
+    auto result = primecount::pi_async(std::string(x), to_async_options(options));
+    return new primecount_async{result};
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_pi_async: " << e.what() << std::endl;
+    return nullptr;
+  }
+}
+
+primecount_async* primecount_nth_prime_async(const char* n, const primecount_async_options* options)
+{
+  try
+  {
+    if (!n)
+      throw primecount::primecount_error("n must not be a NULL pointer");
+
+    auto result = primecount::nth_prime_async(std::string(n), to_async_options(options));
+    return new primecount_async{result};
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_nth_prime_async: " << e.what() << std::endl;
+    return nullptr;
+  }
+}
+
+int primecount_async_is_ready(primecount_async* handle)
+{
+  return handle && handle->result.is_ready();
+}
+
+int primecount_async_get(primecount_async* handle, char* res, size_t len)
+{
+  try
+  {
+    if (!handle)
+      throw primecount::primecount_error("handle must not be a NULL pointer");
+
+    if (!res)
+      throw primecount::primecount_error("res must not be a NULL pointer");
+
+    std::string str = handle->result.get();
+    return copy_result(str, res, len);
+  }
+  catch(const primecount::primecount_cancelled&)
+  {
+    if (res && len > 0)
+      res[0] = '\0';
+
+    return -2;
+  }
+  catch(const std::exception& e)
+  {
+    std::cerr << "primecount_async_get: " << e.what() << std::endl;
+
+    if (res && len > 0)
+      res[0] = '\0';
+
+    return -1;
+  }
+}
+
+void primecount_async_cancel(primecount_async* handle)
+{
+  if (handle)
+    handle->result.cancel();
+}
+
+void primecount_async_destroy(primecount_async* handle)
+{
+  delete handle;
+}
+
 const char* primecount_get_max_x(void)
 {
 #ifdef HAVE_INT128_T
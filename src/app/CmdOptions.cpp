@@ -191,6 +191,9 @@ namespace primecount {
 void help(int exitCode);
 void version();
 void test();
+void calibrate(maxint_t max_x);
+void set_progress_fd(int fd);
+void serve();
 
 void CmdOptions::setMainOption(OptionID optionID,
                                const std::string& optStr)
@@ -205,6 +208,14 @@ void CmdOptions::setMainOption(OptionID optionID,
   }
 }
 
+void CmdOptions::optionAnchors(Option& opt)
+{
+  set_anchors(true);
+
+  if (!opt.val.empty())
+    load_anchors(opt.val);
+}
+
 void CmdOptions::optionStatus(Option& opt)
 {
   set_print(true);
@@ -227,16 +238,21 @@ CmdOptions parseOptions(int argc, char* argv[])
     { "--alpha", std::make_pair(OPTION_ALPHA, REQUIRED_PARAM) },
     { "--alpha-y", std::make_pair(OPTION_ALPHA_Y, REQUIRED_PARAM) },
     { "--alpha-z", std::make_pair(OPTION_ALPHA_Z, REQUIRED_PARAM) },
+    { "--anchors", std::make_pair(OPTION_ANCHORS, OPTIONAL_PARAM) },
+    { "--calibrate", std::make_pair(OPTION_CALIBRATE, OPTIONAL_PARAM) },
     { "-d", std::make_pair(OPTION_DELEGLISE_RIVAT, NO_PARAM) },
     { "--deleglise-rivat", std::make_pair(OPTION_DELEGLISE_RIVAT, NO_PARAM) },
     { "--deleglise-rivat-64", std::make_pair(OPTION_DELEGLISE_RIVAT_64, NO_PARAM) },
     { "--deleglise-rivat-128", std::make_pair(OPTION_DELEGLISE_RIVAT_128, NO_PARAM) },
+    { "--estimate", std::make_pair(OPTION_ESTIMATE, NO_PARAM) },
+    { "--generate-pi-table", std::make_pair(OPTION_GENERATE_PI_TABLE, REQUIRED_PARAM) },
     { "-g", std::make_pair(OPTION_GOURDON, NO_PARAM) },
     { "--gourdon", std::make_pair(OPTION_GOURDON, NO_PARAM) },
     { "--gourdon-64", std::make_pair(OPTION_GOURDON_64, NO_PARAM) },
     { "--gourdon-128", std::make_pair(OPTION_GOURDON_128, NO_PARAM) },
     { "-h", std::make_pair(OPTION_HELP, NO_PARAM) },
     { "--help", std::make_pair(OPTION_HELP, NO_PARAM) },
+    { "--input", std::make_pair(OPTION_INPUT, REQUIRED_PARAM) },
     { "-l", std::make_pair(OPTION_LEGENDRE, NO_PARAM) },
     { "--legendre", std::make_pair(OPTION_LEGENDRE, NO_PARAM) },
     { "--lehmer", std::make_pair(OPTION_LEHMER, NO_PARAM) },
@@ -255,17 +271,22 @@ CmdOptions parseOptions(int argc, char* argv[])
     { "--number", std::make_pair(OPTION_NUMBER, REQUIRED_PARAM) },
     { "-p", std::make_pair(OPTION_PRIMESIEVE, NO_PARAM) },
     { "--primesieve", std::make_pair(OPTION_PRIMESIEVE, NO_PARAM) },
+    { "--progress-fd", std::make_pair(OPTION_PROGRESS_FD, REQUIRED_PARAM) },
     { "--Li", std::make_pair(OPTION_LI, NO_PARAM) },
     { "--Li-inverse", std::make_pair(OPTION_LIINV, NO_PARAM) },
     { "-R", std::make_pair(OPTION_R, NO_PARAM) },
     { "--RiemannR", std::make_pair(OPTION_R, NO_PARAM) },
     { "--RiemannR-inverse", std::make_pair(OPTION_R_INVERSE, NO_PARAM) },
+    { "--range", std::make_pair(OPTION_RANGE, NO_PARAM) },
+    { "--resume", std::make_pair(OPTION_RESUME, NO_PARAM) },
     { "--phi", std::make_pair(OPTION_PHI, NO_PARAM) },
+    { "--pi-table", std::make_pair(OPTION_PI_TABLE, REQUIRED_PARAM) },
     { "--P2", std::make_pair(OPTION_P2, NO_PARAM) },
     { "--S1", std::make_pair(OPTION_S1, NO_PARAM) },
     { "--S2-easy", std::make_pair(OPTION_S2_EASY, NO_PARAM) },
     { "--S2-hard", std::make_pair(OPTION_S2_HARD, NO_PARAM) },
     { "--S2-trivial", std::make_pair(OPTION_S2_TRIVIAL, NO_PARAM) },
+    { "--serve", std::make_pair(OPTION_SERVE, NO_PARAM) },
     { "--AC", std::make_pair(OPTION_AC, NO_PARAM) },
     { "-B", std::make_pair(OPTION_B, NO_PARAM) },
     { "--B", std::make_pair(OPTION_B, NO_PARAM) },
@@ -275,6 +296,7 @@ CmdOptions parseOptions(int argc, char* argv[])
     { "--Sigma", std::make_pair(OPTION_SIGMA, NO_PARAM) },
     { "-s", std::make_pair(OPTION_STATUS, OPTIONAL_PARAM) },
     { "--status", std::make_pair(OPTION_STATUS, OPTIONAL_PARAM) },
+    { "--stdin", std::make_pair(OPTION_STDIN, NO_PARAM) },
     { "--test", std::make_pair(OPTION_TEST, NO_PARAM) },
     { "--time", std::make_pair(OPTION_TIME, NO_PARAM) },
     { "-t", std::make_pair(OPTION_THREADS, REQUIRED_PARAM) },
@@ -286,6 +308,8 @@ CmdOptions parseOptions(int argc, char* argv[])
 
   CmdOptions opts;
   Vector<maxint_t> numbers;
+  maxint_t calibrate_max_x = -1;
+  bool is_serve = false;
 
   for (int i = 1; i < argc; i++)
   {
@@ -297,10 +321,19 @@ CmdOptions parseOptions(int argc, char* argv[])
       case OPTION_ALPHA:   set_alpha(opt.to<double>()); break;
       case OPTION_ALPHA_Y: set_alpha_y(opt.to<double>()); break;
       case OPTION_ALPHA_Z: set_alpha_z(opt.to<double>()); break;
+      case OPTION_ANCHORS: opts.optionAnchors(opt); break;
+      case OPTION_CALIBRATE: calibrate_max_x = opt.val.empty() ? (maxint_t) 1e14 : opt.to<maxint_t>(); break;
+      case OPTION_GENERATE_PI_TABLE: opts.piTableFile = opt.val; opts.setMainOption(optionID, opt.str); break;
       case OPTION_NUMBER:  numbers.push_back(opt.to<maxint_t>()); break;
+      case OPTION_PI_TABLE: load_pi_table(opt.val); break;
+      case OPTION_PROGRESS_FD: set_progress_fd(opt.to<int>()); break;
+      case OPTION_SERVE:   is_serve = true; break;
       case OPTION_THREADS: set_num_threads(opt.to<int>()); break;
       case OPTION_HELP:    help(/* exitCode */ 0); break;
+      case OPTION_INPUT:   opts.bulk = true; opts.inputFile = opt.val; break;
+      case OPTION_RESUME:  opts.resume = true; break;
       case OPTION_STATUS:  opts.optionStatus(opt); break;
+      case OPTION_STDIN:   opts.bulk = true; break;
       case OPTION_TIME:    opts.time = true; break;
       case OPTION_TEST:    test(); break;
       case OPTION_VERIFY:  set_verify_computation(true); break;
@@ -309,6 +342,26 @@ CmdOptions parseOptions(int argc, char* argv[])
     }
   }
 
+  // Calibrate after all other options (e.g. --threads)
+  // have been parsed, calibrate() does not return.
+  if (calibrate_max_x >= 0)
+    calibrate(calibrate_max_x);
+
+  // Answer requests read from stdin using the
+  // options parsed above, serve() does not return.
+  if (is_serve)
+    serve();
+
+  if (opts.resume && opts.inputFile.empty())
+    throw primecount_error("option --resume requires --input=FILE");
+
+  if (opts.bulk)
+  {
+    if (!numbers.empty())
+      throw primecount_error("numbers are not allowed with --stdin and --input");
+    return opts;
+  }
+
   if (opts.option == OPTION_PHI)
   {
     if (numbers.size() < 2)
@@ -316,6 +369,13 @@ CmdOptions parseOptions(int argc, char* argv[])
     opts.a = numbers[1];
   }
 
+  if (opts.option == OPTION_RANGE)
+  {
+    if (numbers.size() < 2)
+      throw primecount_error("option --range requires 2 numbers");
+    opts.y = numbers[1];
+  }
+
   if (numbers.empty())
     throw primecount_error("missing x number");
 
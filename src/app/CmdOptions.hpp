@@ -24,14 +24,19 @@ enum OptionID
   OPTION_ALPHA,
   OPTION_ALPHA_Y,
   OPTION_ALPHA_Z,
+  OPTION_ANCHORS,
+  OPTION_CALIBRATE,
   OPTION_DEFAULT,
   OPTION_DELEGLISE_RIVAT,
   OPTION_DELEGLISE_RIVAT_64,
   OPTION_DELEGLISE_RIVAT_128,
+  OPTION_ESTIMATE,
+  OPTION_GENERATE_PI_TABLE,
   OPTION_GOURDON,
   OPTION_GOURDON_64,
   OPTION_GOURDON_128,
   OPTION_HELP,
+  OPTION_INPUT,
   OPTION_LEGENDRE,
   OPTION_LEHMER,
   OPTION_LMO,
@@ -46,22 +51,28 @@ enum OptionID
   OPTION_NTHPRIME_128,
   OPTION_NUMBER,
   OPTION_PRIMESIEVE,
+  OPTION_PROGRESS_FD,
   OPTION_LI,
   OPTION_LIINV,
   OPTION_R,
   OPTION_R_INVERSE,
+  OPTION_RANGE,
+  OPTION_RESUME,
   OPTION_PHI,
+  OPTION_PI_TABLE,
   OPTION_P2,
   OPTION_S1,
   OPTION_S2_EASY,
   OPTION_S2_HARD,
   OPTION_S2_TRIVIAL,
+  OPTION_SERVE,
   OPTION_AC,
   OPTION_B,
   OPTION_D,
   OPTION_PHI0,
   OPTION_SIGMA,
   OPTION_STATUS,
+  OPTION_STDIN,
   OPTION_TEST,
   OPTION_TIME,
   OPTION_THREADS,
@@ -102,9 +113,18 @@ struct CmdOptions
   int option = OPTION_DEFAULT;
   maxint_t x = -1;
   int64_t a = -1;
+  /// Upper bound of --range [x, y]
+  maxint_t y = -1;
   bool time = false;
+  /// Bulk mode: read the numbers from stdin or from inputFile
+  bool bulk = false;
+  bool resume = false;
+  std::string inputFile;
+  /// Output file of --generate-pi-table=FILE
+  std::string piTableFile;
 
   void setMainOption(OptionID optionID, const std::string& optStr);
+  void optionAnchors(Option& opt);
   void optionStatus(Option& opt);
 };
 
@@ -0,0 +1,282 @@
+///
+/// @file  bulk.cpp
+/// @brief Bulk mode (options: --stdin, --input=FILE). Reads one
+///        number (or integer expression) per line and writes one
+///        result per line, in the order of the input. Each result
+///        is flushed as soon as it and all results of the previous
+///        lines have been computed. Empty lines and lines starting
+///        with '#' are skipped.
+///
+///        For pi(x) nearby numbers are computed together: the
+///        numbers are sorted and split into clusters of numbers
+///        whose distance to the previous number is small enough so
+///        that sieving the gap is faster than computing pi(x) from
+///        scratch. For each cluster we compute pi(x) of its
+///        smallest number and then count the primes inside the
+///        gaps using the segmented sieve of Eratosthenes.
+///
+///        --input=FILE clusters all numbers of the file. --stdin
+///        is processed line by line (e.g. for pipes that stay
+///        open), only the lines that have already arrived are
+///        clustered together, at most max_window lines at once.
+///
+///        When reading from a file, the number of the last
+///        completed line is stored in FILE.checkpoint. Using
+///        --resume the lines that have already been completed
+///        are skipped.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "CmdOptions.hpp"
+
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <int128_t.hpp>
+#include <Vector.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+
+using namespace primecount;
+
+namespace {
+
+/// Maximum number of stdin lines that are clustered together
+const std::size_t max_window = 1 << 10;
+
+struct Number
+{
+  /// Line number inside the input (1st line = 1)
+  int64_t line;
+  maxint_t x;
+};
+
+void check_option(const CmdOptions& opts)
+{
+  switch (opts.option)
+  {
+    case OPTION_DEFAULT:
+    case OPTION_NTHPRIME:
+    case OPTION_LI:
+    case OPTION_LIINV:
+    case OPTION_R:
+    case OPTION_R_INVERSE:
+      return;
+    default:
+      throw primecount_error("option " + opts.optionStr + " is not supported in bulk mode");
+  }
+}
+
+maxint_t compute(int option, maxint_t x, int threads)
+{
+  switch (option)
+  {
+    case OPTION_NTHPRIME:   return nth_prime(x, threads);
+    case OPTION_LI:         return Li(x);
+    case OPTION_LIINV:      return Li_inverse(x);
+    case OPTION_R:          return RiemannR(x);
+    case OPTION_R_INVERSE:  return RiemannR_inverse(x);
+    default:                return pi(x, threads);
+  }
+}
+
+int64_t read_checkpoint(const std::string& filename)
+{
+  std::ifstream file(filename);
+  int64_t line = 0;
+  if (!(file >> line))
+    return 0;
+  return line;
+}
+
+void write_checkpoint(const std::string& filename, int64_t line)
+{
+  std::ofstream file(filename, std::ios::trunc);
+  file << line << std::endl;
+}
+
+/// Read the next number, skip the lines <= skip_lines.
+/// Returns false once the end of the input is reached.
+///
+bool read_number(std::istream& input,
+                 int64_t& line,
+                 int64_t skip_lines,
+                 Number& number)
+{
+  std::string str;
+
+  while (std::getline(input, str))
+  {
+    line++;
+    std::size_t pos = str.find_last_not_of(" \t\r");
+    str.erase((pos == std::string::npos) ? 0 : pos + 1);
+    str.erase(0, str.find_first_not_of(" \t"));
+
+    if (line <= skip_lines ||
+        str.empty() ||
+        str[0] == '#')
+      continue;
+
+    try
+    {
+      number = Number{line, to_maxint(str)};
+      return true;
+    }
+    catch (const std::exception& e)
+    {
+      throw primecount_error("line " + std::to_string(line) + ": " + e.what());
+    }
+  }
+
+  return false;
+}
+
+/// Cluster of nearby numbers, sorted[begin, end[
+struct Cluster
+{
+  std::size_t begin;
+  std::size_t end;
+};
+
+/// Compute pi(x) of all numbers inside the cluster, the primes
+/// inside the gaps between the numbers are counted using the
+/// segmented sieve of Eratosthenes.
+///
+void compute_cluster(const Vector<maxint_t>& sorted,
+                     const Cluster& cluster,
+                     std::map<maxint_t, maxint_t>& results,
+                     int threads)
+{
+  maxint_t x = sorted[cluster.begin];
+  maxint_t res = pi(x, threads);
+  results[x] = res;
+
+  for (std::size_t i = cluster.begin + 1; i < cluster.end; i++)
+  {
+    int64_t start = (int64_t) sorted[i - 1] + 1;
+    int64_t stop = (int64_t) sorted[i];
+    res += count_primes(start, stop, threads);
+    results[sorted[i]] = res;
+  }
+}
+
+/// Compute the results of the numbers and print them in
+/// the order of the input. If checkpoint is not empty the
+/// line number of the last printed result is written to
+/// the checkpoint file.
+///
+void compute_numbers(const CmdOptions& opts,
+                     const Vector<Number>& numbers,
+                     const std::string& checkpoint)
+{
+  Vector<maxint_t> sorted;
+  Vector<Cluster> clusters;
+  std::map<maxint_t, std::size_t> cluster_of;
+  std::map<maxint_t, maxint_t> results;
+
+  // Split the sorted numbers into clusters of nearby numbers.
+  // Only pi(x) benefits from this, for the other
+  // functions each number is its own cluster.
+  if (opts.option == OPTION_DEFAULT)
+  {
+    for (const Number& n : numbers)
+      sorted.push_back(n.x);
+
+    std::sort(sorted.begin(), sorted.end());
+    sorted.resize(std::unique(sorted.begin(), sorted.end()) - sorted.begin());
+
+    for (std::size_t i = 0; i < sorted.size(); i++)
+    {
+      if (i == 0 ||
+          sorted[i] - sorted[i - 1] > max_sieve_distance(sorted[i - 1]))
+        clusters.push_back(Cluster{i, i + 1});
+      else
+        clusters.back().end = i + 1;
+
+      cluster_of[sorted[i]] = clusters.size() - 1;
+    }
+  }
+
+  int threads = get_num_threads();
+
+  for (const Number& n : numbers)
+  {
+    auto iter = results.find(n.x);
+
+    if (iter == results.end())
+    {
+      if (opts.option == OPTION_DEFAULT)
+        compute_cluster(sorted, clusters[cluster_of[n.x]], results, threads);
+      else
+        results[n.x] = compute(opts.option, n.x, threads);
+
+      iter = results.find(n.x);
+    }
+
+    std::cout << iter->second << std::endl;
+
+    if (!checkpoint.empty())
+      write_checkpoint(checkpoint, n.line);
+  }
+}
+
+} // namespace
+
+namespace primecount {
+
+void bulk(const CmdOptions& opts)
+{
+  check_option(opts);
+  Vector<Number> numbers;
+  Number number;
+  int64_t line = 0;
+
+  if (opts.inputFile.empty())
+  {
+    // Without synchronization with C stdio, std::cin
+    // knows how many characters have already arrived.
+    std::ios_base::sync_with_stdio(false);
+
+    while (read_number(std::cin, line, 0, number))
+    {
+      numbers.clear();
+      numbers.push_back(number);
+
+      // Cluster the lines that are already available,
+      // never wait for more input.
+      while (numbers.size() < max_window &&
+             std::cin.rdbuf()->in_avail() > 0 &&
+             read_number(std::cin, line, 0, number))
+        numbers.push_back(number);
+
+      compute_numbers(opts, numbers, "");
+    }
+  }
+  else
+  {
+    std::ifstream file(opts.inputFile);
+    if (!file)
+      throw primecount_error("failed to open '" + opts.inputFile + "'");
+
+    std::string checkpoint = opts.inputFile + ".checkpoint";
+    int64_t skip_lines = 0;
+    if (opts.resume)
+      skip_lines = read_checkpoint(checkpoint);
+
+    while (read_number(file, line, skip_lines, number))
+      numbers.push_back(number);
+
+    compute_numbers(opts, numbers, checkpoint);
+  }
+}
+
+} // namespace
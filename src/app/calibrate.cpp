@@ -0,0 +1,280 @@
+///
+/// @file  calibrate.cpp
+/// @brief Find the fastest alpha_y and alpha_z tuning factors and
+///        thread limits for the user's CPU (option: --calibrate).
+///
+///        primecount's default tuning factors have been determined
+///        by benchmarking on the author's computers. CPUs with
+///        much smaller or larger caches may run faster using
+///        different tuning factors. --calibrate computes pi(10^n)
+///        for a few small n using different tuning factors and
+///        stores the fastest tuning factors in a tuning file
+///        which is loaded by all subsequent pi(x) computations.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <gourdon.hpp>
+#include <imath.hpp>
+#include <int128_t.hpp>
+#include <tuning.hpp>
+#include <print.hpp>
+#include <Vector.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace primecount;
+
+namespace {
+
+/// Each pi(x) computation is repeated a few times
+/// and the fastest time is used. This reduces the
+/// noise from other processes.
+///
+const int repeat = 3;
+
+/// Correction factors for primecount's default
+/// alpha_y * alpha_z polynomial.
+///
+const Array<double, 10> alpha_yz_factors =
+{
+  0.5, 0.625, 0.75, 0.875, 1.0, 1.125, 1.25, 1.5, 1.75, 2.0
+};
+
+const Array<double, 8> alpha_z_values =
+{
+  1.0, 1.25, 1.5, 1.75, 2.0, 2.5, 3.0, 4.0
+};
+
+const Array<double, 5> threads_exponents =
+{
+  3.0, 3.35, 3.7, 4.05, 4.4
+};
+
+struct Sample
+{
+  int64_t x;
+  int64_t pix;
+  double alpha_yz;
+  double alpha_z;
+};
+
+/// Returns the fastest time (in seconds) of
+/// computing pi(x) using the given tuning factors.
+///
+double benchmark(const Sample& sample,
+                 double alpha_y,
+                 double alpha_z,
+                 int threads)
+{
+  set_alpha_y(alpha_y);
+  set_alpha_z(alpha_z);
+  double min_seconds = 0;
+
+  for (int i = 0; i < repeat; i++)
+  {
+    double time = get_time();
+    int64_t pix = pi_gourdon_64(sample.x, threads, false);
+    double seconds = get_time() - time;
+
+    // We also check the results while calibrating,
+    // all tuning factors must produce the same pi(x).
+    if (pix != sample.pix)
+    {
+      std::ostringstream oss;
+      oss << "pi_gourdon_64(" << sample.x << ") = " << pix
+          << " is an error, the correct result is " << sample.pix
+          << " (alpha_y = " << alpha_y << ", alpha_z = " << alpha_z << ")";
+      throw primecount_error(oss.str());
+    }
+
+    if (i == 0 || seconds < min_seconds)
+      min_seconds = seconds;
+  }
+
+  return min_seconds;
+}
+
+/// Find the fastest alpha_yz correction factor and
+/// afterwards the fastest alpha_z for the given x.
+///
+void calibrate_alpha(Sample& sample, int threads)
+{
+  auto alpha = get_alpha_gourdon(sample.x);
+  double alpha_yz = alpha.first * alpha.second;
+  double alpha_z = alpha.second;
+  double default_seconds = benchmark(sample, alpha.first, alpha_z, threads);
+  double min_seconds = default_seconds;
+  double best_factor = 1.0;
+
+  for (double factor : alpha_yz_factors)
+  {
+    double alpha_y = alpha_yz * factor / alpha_z;
+    double seconds = benchmark(sample, alpha_y, alpha_z, threads);
+    if (seconds < min_seconds)
+    {
+      min_seconds = seconds;
+      best_factor = factor;
+    }
+  }
+
+  double best_alpha_z = alpha_z;
+  alpha_yz *= best_factor;
+
+  for (double az : alpha_z_values)
+  {
+    // alpha_y must be >= 1
+    if (alpha_yz / az < 1)
+      continue;
+
+    double seconds = benchmark(sample, alpha_yz / az, az, threads);
+    if (seconds < min_seconds)
+    {
+      min_seconds = seconds;
+      best_alpha_z = az;
+    }
+  }
+
+  sample.alpha_yz = best_factor;
+  sample.alpha_z = best_alpha_z;
+
+  std::cout << std::fixed << std::setprecision(3)
+            << "x = " << sample.x
+            << ", alpha_yz_factor = " << best_factor
+            << ", alpha_z = " << best_alpha_z
+            << ", seconds = " << min_seconds
+            << " (default: " << default_seconds << ")"
+            << std::defaultfloat << std::endl;
+}
+
+/// The thread limits of the D and AC formulas only matter if
+/// the user's CPU has more threads than the limit for the
+/// largest x we calibrate. In this case we try a few
+/// different limits for both formulas.
+///
+double calibrate_threads(const Sample& sample, int threads)
+{
+  Tuning tuning = get_tuning();
+  double exponent = tuning.D_threads_exponent;
+  auto alpha = get_alpha_gourdon(sample.x);
+  int64_t y = (int64_t)(iroot<3>(sample.x) * alpha.first);
+  int64_t z = (int64_t)(y * alpha.second);
+  int64_t xz = sample.x / std::max(z, (int64_t) 1);
+
+  if (threads <= get_max_threads_D(xz))
+  {
+    std::cout << "Thread limits: not needed for " << threads << " threads" << std::endl;
+    return exponent;
+  }
+
+  double min_seconds = -1;
+
+  for (double e : threads_exponents)
+  {
+    tuning.D_threads_exponent = e;
+    tuning.AC_threads_exponent = e;
+    set_tuning(tuning);
+
+    double seconds = benchmark(sample, alpha.first, alpha.second, threads);
+    if (min_seconds < 0 || seconds < min_seconds)
+    {
+      min_seconds = seconds;
+      exponent = e;
+    }
+  }
+
+  std::cout << "Thread limits: max_threads = (x / z)^(1 / " << exponent << ")" << std::endl;
+  return exponent;
+}
+
+} // namespace
+
+namespace primecount {
+
+/// Calibrate using pi(10^12), pi(10^13), ..., pi(max_x).
+/// Larger x produce more accurate tuning factors,
+/// but calibrating takes much longer.
+///
+void calibrate(maxint_t max_x)
+{
+  set_print(false);
+  int threads = get_num_threads();
+  std::string filename = get_tuning_file();
+  Vector<Sample> samples;
+
+  max_x = in_between(1e12, max_x, 1e18);
+  for (int64_t x = (int64_t) 1e12; x <= max_x; x *= 10)
+    samples.push_back(Sample{x, 0, 1.0, 2.0});
+
+  try
+  {
+    // Calibrate using primecount's default tuning
+    // factors, not using an old tuning file.
+    Tuning tuning;
+    set_tuning(tuning);
+    set_alpha_y(-1);
+    set_alpha_z(-1);
+
+    std::cout << "Calibrating primecount, threads = " << threads << std::endl;
+
+    for (Sample& sample : samples)
+    {
+      sample.pix = pi_gourdon_64(sample.x, threads, false);
+      calibrate_alpha(sample, threads);
+    }
+
+    // Weighted geometric mean, larger x
+    // have a larger weight.
+    double sum = 0;
+    double weights = 0;
+    for (std::size_t i = 0; i < samples.size(); i++)
+    {
+      double weight = i + 1.0;
+      sum += weight * std::log(samples[i].alpha_yz);
+      weights += weight;
+    }
+
+    // alpha_z is a small constant, we use the
+    // fastest alpha_z of the largest x.
+    tuning.alpha_yz_factor = std::exp(sum / weights);
+    tuning.alpha_yz_factor = std::round(tuning.alpha_yz_factor * 1000) / 1000;
+    tuning.alpha_z = samples.back().alpha_z;
+    set_tuning(tuning);
+    set_alpha_y(-1);
+    set_alpha_z(-1);
+
+    double exponent = calibrate_threads(samples.back(), threads);
+    tuning.D_threads_exponent = exponent;
+    tuning.AC_threads_exponent = exponent;
+    set_tuning(tuning);
+    set_alpha_y(-1);
+    set_alpha_z(-1);
+
+    std::ostringstream comment;
+    comment << "# threads = " << threads << ", max x = " << samples.back().x << "\n";
+    write_tuning_file(tuning, filename, comment.str());
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << std::endl << "primecount: " << e.what() << std::endl;
+    std::exit(1);
+  }
+
+  std::cout << "Tuning file: " << filename << std::endl;
+  std::exit(0);
+}
+
+} // namespace
@@ -23,9 +23,17 @@ void help(int exitCode)
     "\n"
     "Options:\n"
     "\n"
+    "      --anchors[=FILE]     Compute pi(x) using known values of pi(x) nearby,\n"
+    "                           optionally load more known values from FILE\n"
     "  -d, --deleglise-rivat    Count primes using the Deleglise-Rivat algorithm\n"
+    "      --estimate           Estimate the runtime and memory usage of pi(x)\n"
+    "      --generate-pi-table=FILE\n"
+    "                           Generate a lookup table of pi(n) for all n <= x\n"
+    "                           and store it in FILE, see --pi-table\n"
     "  -g, --gourdon            Count primes using Xavier Gourdon's algorithm.\n"
     "                           This is the default algorithm.\n"
+    "      --input=FILE         Read the numbers from FILE (one per line) and\n"
+    "                           print the results (one per line)\n"
     "  -l, --legendre           Count primes using Legendre's formula\n"
     "      --lehmer             Count primes using Lehmer's formula\n"
     "      --lmo                Count primes using Lagarias-Miller-Odlyzko\n"
@@ -36,10 +44,21 @@ void help(int exitCode)
     "  -p, --primesieve         Count primes using the sieve of Eratosthenes\n"
     "      --phi <X> <A>        phi(x, a) counts the numbers <= x that are not\n"
     "                           divisible by any of the first a primes\n"
+    "      --pi-table=FILE      Compute pi(x) in O(1) using the lookup table\n"
+    "                           FILE, see --generate-pi-table\n"
+    "      --range <A> <B>      Count the primes inside [A, B]\n"
+    "      --resume             Skip the lines of --input=FILE that have\n"
+    "                           already been completed\n"
     "  -R, --RiemannR           Approximate pi(x) using the Riemann R function\n"
     "      --RiemannR-inverse   Approximate the nth prime using R^-1(x)\n"
+    "      --progress-fd=NUM    Write the computation progress as JSON lines\n"
+    "                           to the file descriptor NUM\n"
+    "      --serve              Answer requests (e.g. pi 1e12) read line by line\n"
+    "                           from stdin until EOF using a result cache,\n"
+    "                           see the manpage\n"
     "  -s, --status[=NUM]       Show computation progress 1%, 2%, 3%, ...\n"
     "                           Set digits after decimal point: -s1 prints 99.9%\n"
+    "      --stdin              Read the numbers from stdin (one per line)\n"
     "      --test               Run various correctness tests and exit\n"
     "      --time               Print the time elapsed in seconds\n"
     "  -t, --threads=NUM        Set the number of threads, 1 <= NUM <= CPU cores.\n"
@@ -62,6 +81,9 @@ void help(int exitCode)
     "\n"
     "      --alpha-y=NUM        Set tuning factor: y = x^(1/3) * alpha_y\n"
     "      --alpha-z=NUM        Set tuning factor: z = y * alpha_z\n"
+    "      --calibrate[=NUM]    Find the fastest tuning factors for your CPU\n"
+    "                           using x <= NUM (default 1e14) and store them\n"
+    "                           in $HOME/.primecount-tuning.txt\n"
     "      --AC                 Compute the A + C formulas\n"
     "      --B                  Compute the B formula\n"
     "      --D                  Compute the D formula\n"
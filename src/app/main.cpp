@@ -25,22 +25,28 @@
 
 #include <primecount.hpp>
 #include <primecount-internal.hpp>
+#include <estimate.hpp>
 #include <gourdon.hpp>
 #include <imath.hpp>
 #include <int128_t.hpp>
 #include <PhiTiny.hpp>
 #include <print.hpp>
 #include <S.hpp>
+#include <tuning.hpp>
 
 #include <stdint.h>
 #include <exception>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 using namespace primecount;
 
 namespace primecount {
 
+void bulk(const CmdOptions& opts);
+
 int64_t to_int64(maxint_t x)
 {
   if (x > pstd::numeric_limits<int64_t>::max())
@@ -343,6 +349,69 @@ maxint_t S2_hard(maxint_t x, int threads)
     return S2_hard(x, y, z, c, Li(x), threads);
 }
 
+std::string to_bytes_str(uint64_t bytes)
+{
+  const char* units[] = { "bytes", "KiB", "MiB", "GiB", "TiB", "PiB" };
+  double size = (double) bytes;
+  int i = 0;
+
+  for (; size >= 1024 && i < 5; i++)
+    size /= 1024;
+
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(i > 0 ? 2 : 0) << size << " " << units[i];
+  return oss.str();
+}
+
+std::string to_time_str(double seconds)
+{
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(3) << seconds << " sec";
+
+  if (seconds >= 3600 * 24)
+    oss << std::setprecision(1) << " (" << seconds / (3600 * 24) << " days)";
+  else if (seconds >= 3600)
+    oss << std::setprecision(1) << " (" << seconds / 3600 << " hours)";
+  else if (seconds >= 60)
+    oss << std::setprecision(1) << " (" << seconds / 60 << " minutes)";
+
+  return oss.str();
+}
+
+/// Print the estimated runtime (per formula)
+/// and the estimated peak memory usage.
+///
+void print_estimate(maxint_t x, int threads)
+{
+  Estimate est = estimate(x, threads);
+
+  std::cout << "=== estimate(x) ===" << std::endl;
+  std::cout << "x = " << est.x << std::endl;
+  std::cout << "y = " << est.y << std::endl;
+  std::cout << "z = " << est.z << std::endl;
+  std::cout << "threads = " << est.threads << std::endl;
+  std::cout << "sample x = " << est.sample_x << ", sample seconds = "
+            << std::fixed << std::setprecision(3) << est.sample_seconds << std::endl;
+  std::cout << std::endl;
+
+  for (const auto& formula : est.formulas)
+    std::cout << std::left << std::setw(22) << formula.name
+              << to_time_str(formula.seconds) << std::endl;
+
+  std::cout << std::left << std::setw(22) << "Total" << to_time_str(est.seconds) << std::endl;
+  std::cout << std::endl;
+
+  for (const auto& table : est.tables)
+  {
+    std::string name = std::string(table.name) + " (" + table.formula + ")";
+    std::cout << std::left << std::setw(22) << name
+              << to_bytes_str(table.bytes) << std::endl;
+  }
+
+  std::cout << std::left << std::setw(22) << "Peak memory usage"
+            << to_bytes_str(est.peak_memory) << std::endl;
+}
+
 } // namespace
 
 int main (int argc, char* argv[])
@@ -352,6 +421,17 @@ int main (int argc, char* argv[])
     CmdOptions opts = parseOptions(argc, argv);
     double time = get_time();
 
+    // Use the tuning factors of primecount --calibrate
+    load_tuning_file();
+
+    if (opts.bulk)
+    {
+      bulk(opts);
+      if (opts.time)
+        print_seconds(get_time() - time);
+      return 0;
+    }
+
     auto x = opts.x;
     auto a = opts.a;
     auto threads = get_num_threads();
@@ -361,10 +441,16 @@ int main (int argc, char* argv[])
     {
       case OPTION_DEFAULT:
         res = pi(x, threads); break;
+      case OPTION_ESTIMATE:
+        print_estimate(x, threads); return 0;
       case OPTION_DELEGLISE_RIVAT:
         res = pi_deleglise_rivat(x, threads); break;
       case OPTION_DELEGLISE_RIVAT_64:
         res = pi_deleglise_rivat_64(to_int64(x), threads); break;
+      case OPTION_GENERATE_PI_TABLE:
+        generate_pi_table(opts.piTableFile, to_int64(x));
+        load_pi_table(opts.piTableFile);
+        res = pi(x, threads); break;
       case OPTION_GOURDON:
         res = pi_gourdon(x, threads); break;
       case OPTION_GOURDON_64:
@@ -403,6 +489,8 @@ int main (int argc, char* argv[])
         res = nth_prime_64(x, threads); break;
       case OPTION_PHI:
         res = phi(to_int64(x), a, threads); break;
+      case OPTION_RANGE:
+        res = pi_range(x, opts.y, threads); break;
       case OPTION_P2:
         res = P2(x, threads); break;
       case OPTION_S1:
@@ -0,0 +1,79 @@
+///
+/// @file  progress_fd.cpp
+/// @brief Write the progress of the formulas as JSON lines to
+///        a file descriptor (option: --progress-fd=N). Unlike
+///        the --status output, which overwrites the previous
+///        status using carriage returns, the progress lines are
+///        meant to be parsed by other programs e.g.:
+///
+///        {"formula":"D","percent":12.34,"seconds":5.678,"sum":"123456"}
+///
+///        The sum is a string because it may be a 128-bit
+///        integer which is not supported by many JSON parsers.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <int128_t.hpp>
+
+#include <stdint.h>
+#include <cstdio>
+#include <string>
+
+#if defined(_WIN32)
+  #include <io.h>
+#else
+  #include <unistd.h>
+#endif
+
+using namespace primecount;
+
+namespace {
+
+/// Write the entire line using a single system call so
+/// that lines from different threads are not interleaved.
+///
+void write_line(int fd, const std::string& line)
+{
+#if defined(_WIN32)
+  _write(fd, line.data(), (unsigned) line.size());
+#else
+  ssize_t bytes = write(fd, line.data(), line.size());
+  (void) bytes;
+#endif
+}
+
+} // namespace
+
+namespace primecount {
+
+void set_progress_fd(int fd)
+{
+  if (fd < 0)
+    throw primecount_error("invalid option '--progress-fd=" + std::to_string(fd) + "'");
+
+  set_progress_callback([fd](const pc_progress_t& progress)
+  {
+    maxint_t sum = (maxint_t) progress.sum.lo;
+#if defined(HAVE_INT128_T)
+    sum |= ((maxint_t) progress.sum.hi) << 64;
+#endif
+
+    char buffer[128];
+    std::snprintf(buffer, sizeof(buffer),
+                  "{\"formula\":\"%s\",\"percent\":%.2f,\"seconds\":%.3f,\"sum\":\"",
+                  progress.formula, progress.percent, progress.seconds);
+
+    std::string line = buffer;
+    line += to_string(sum);
+    line += "\"}\n";
+    write_line(fd, line);
+  });
+}
+
+} // namespace
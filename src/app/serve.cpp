@@ -0,0 +1,285 @@
+///
+/// @file  serve.cpp
+/// @brief Long running query server (option: --serve). Reads one
+///        request per line from stdin and writes one response per
+///        line to stdout. This avoids paying the process start-up
+///        costs for each query, e.g.:
+///
+///        $ primecount --serve
+///        pi 1e12
+///        pi 1e12 = 37607912018
+///        nth_prime 10^9
+///        nth_prime 10^9 = 22801763489
+///
+///        Supported requests: pi x, nth_prime n, phi x a, Li x,
+///        Li_inverse x, RiemannR x, RiemannR_inverse x, quit.
+///
+///        The requests are computed concurrently by primecount's
+///        pool of worker threads (AsyncPool), all requests share
+///        the threads set using --threads. Hence the responses
+///        are written in the order in which the computations
+///        finish, each response starts with its request. Errors
+///        are reported as: "request = error: message".
+///
+///        Only the results are cached: they are stored in a least
+///        recently used cache whose memory usage is limited to
+///        64 MiB, so that repeated requests are answered without
+///        recomputing. The lookup tables of the formulas (primes,
+///        PiTable, PhiCache) depend on x and are rebuilt for each
+///        request.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <AsyncPool.hpp>
+#include <cancel.hpp>
+#include <int128_t.hpp>
+#include <print.hpp>
+#include <Vector.hpp>
+
+#include <stdint.h>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+using namespace primecount;
+
+namespace {
+
+/// Least recently used cache of the results
+class ResultCache
+{
+public:
+  ResultCache(std::size_t max_bytes) :
+    max_bytes_(max_bytes)
+  { }
+
+  bool get(const std::string& key, std::string& value)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = map_.find(key);
+    if (iter == map_.end())
+      return false;
+
+    // Move to the front of the list
+    list_.splice(list_.begin(), list_, iter->second);
+    value = iter->second->second;
+    return true;
+  }
+
+  void insert(const std::string& key, const std::string& value)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (map_.count(key))
+      return;
+
+    list_.emplace_front(key, value);
+    map_[key] = list_.begin();
+    bytes_ += entry_bytes(key, value);
+
+    // Remove the least recently used results
+    while (bytes_ > max_bytes_ && !list_.empty())
+    {
+      auto& entry = list_.back();
+      bytes_ -= entry_bytes(entry.first, entry.second);
+      map_.erase(entry.first);
+      list_.pop_back();
+    }
+  }
+
+private:
+  /// Approximate memory usage of a cache entry
+  static std::size_t entry_bytes(const std::string& key, const std::string& value)
+  {
+    return key.size() * 2 + value.size() + 128;
+  }
+
+  using List = std::list<std::pair<std::string, std::string>>;
+  List list_;
+  std::unordered_map<std::string, List::iterator> map_;
+  std::size_t bytes_ = 0;
+  std::size_t max_bytes_;
+  std::mutex mutex_;
+};
+
+struct Request
+{
+  std::string line;
+  std::string command;
+  Vector<maxint_t> args;
+  cancel_token token;
+};
+
+std::mutex mutex;
+std::condition_variable cv;
+int pending_requests = 0;
+
+void respond(const std::string& request, const std::string& response)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  std::cout << request << " = " << response << std::endl;
+}
+
+int64_t to_int64(maxint_t x)
+{
+  if (x > pstd::numeric_limits<int64_t>::max())
+    throw primecount_error("x must be < 2^63");
+  return (int64_t) x;
+}
+
+/// Parse a request e.g. "pi 1e12", the key of
+/// the request in the cache is the command
+/// followed by the numbers in decimal.
+///
+std::shared_ptr<Request> parse_request(const std::string& line, std::string& key)
+{
+  auto request = std::make_shared<Request>();
+  request->line = line;
+  std::istringstream iss(line);
+  iss >> request->command;
+  key = request->command;
+
+  std::string arg;
+  while (iss >> arg)
+  {
+    request->args.push_back(to_maxint(arg));
+    key += " " + to_string(request->args.back());
+  }
+
+  const std::string& cmd = request->command;
+  std::size_t args = (cmd == "phi") ? 2 : 1;
+
+  if (cmd != "pi" &&
+      cmd != "nth_prime" &&
+      cmd != "phi" &&
+      cmd != "Li" &&
+      cmd != "Li_inverse" &&
+      cmd != "RiemannR" &&
+      cmd != "RiemannR_inverse")
+    throw primecount_error("unknown request '" + cmd + "'");
+
+  if (request->args.size() != args)
+    throw primecount_error(cmd + " requires " + std::to_string(args) + " number(s)");
+
+  return request;
+}
+
+maxint_t compute(const Request& request, int threads)
+{
+  const std::string& cmd = request.command;
+  maxint_t x = request.args[0];
+
+  if (cmd == "pi")
+    return pi(x, threads);
+  if (cmd == "nth_prime")
+    return nth_prime(x, threads);
+  if (cmd == "phi")
+    return phi(to_int64(x), to_int64(request.args[1]), threads);
+  if (cmd == "Li")
+    return Li(x);
+  if (cmd == "Li_inverse")
+    return Li_inverse(x);
+  if (cmd == "RiemannR")
+    return RiemannR(x);
+  else
+    return RiemannR_inverse(x);
+}
+
+} // namespace
+
+namespace primecount {
+
+/// Answer requests until stdin is closed or until the
+/// quit request, does not return.
+///
+void serve()
+{
+  // The status output would be interleaved
+  // with the responses.
+  set_print(false);
+
+  ResultCache cache(64 << 20);
+  std::string line;
+
+  while (std::getline(std::cin, line))
+  {
+    // Remove trailing whitespace e.g. "\r"
+    std::size_t pos = line.find_last_not_of(" \t\r");
+    line.erase((pos == std::string::npos) ? 0 : pos + 1);
+    line.erase(0, line.find_first_not_of(" \t"));
+
+    if (line.empty() || line[0] == '#')
+      continue;
+    if (line == "quit" || line == "exit")
+      break;
+
+    std::string key;
+    std::string result;
+    std::shared_ptr<Request> request;
+
+    try
+    {
+      request = parse_request(line, key);
+    }
+    catch (const std::exception& e)
+    {
+      respond(line, std::string("error: ") + e.what());
+      continue;
+    }
+
+    if (cache.get(key, result))
+    {
+      respond(line, result);
+      continue;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pending_requests++;
+    }
+
+    AsyncPool::get().submit([request, key, &cache](int threads)
+    {
+      try
+      {
+        CancelScope cancelScope(&request->token);
+        std::string result = to_string(compute(*request, threads));
+        cache.insert(key, result);
+        respond(request->line, result);
+      }
+      catch (const std::exception& e)
+      {
+        respond(request->line, std::string("error: ") + e.what());
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      pending_requests--;
+      cv.notify_all();
+    },
+    [request]
+    {
+      request->token.cancel();
+    }, 0);
+  }
+
+  // Wait until all pending requests have been answered
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [] { return pending_requests == 0; });
+  std::exit(0);
+}
+
+} // namespace
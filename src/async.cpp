@@ -0,0 +1,212 @@
+///
+/// @file  async.cpp
+/// @brief Asynchronous pi(x) and nth_prime(n) computations,
+///        pi_async() and nth_prime_async() return immediately
+///        and run the computation in primecount's own pool of
+///        worker threads (AsyncPool).
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <AsyncPool.hpp>
+#include <cancel.hpp>
+#include <int128_t.hpp>
+#include <Progress.hpp>
+
+#include <stdint.h>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace primecount {
+
+/// Shared by the async_result handles and the job
+/// running in the AsyncPool.
+///
+struct async_state
+{
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool is_ready = false;
+  std::string result;
+  std::exception_ptr error;
+  pc_progress_t progress = { nullptr, 0, 0, { 0, 0 } };
+  cancel_token token;
+  async_options options;
+};
+
+} // namespace
+
+namespace {
+
+using namespace primecount;
+
+void run(std::shared_ptr<async_state> state,
+         maxint_t n,
+         bool is_nth_prime,
+         int threads)
+{
+  try
+  {
+    ProgressCallback callback = [state](const pc_progress_t& progress)
+    {
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->progress = progress;
+      }
+      if (state->options.progress)
+        state->options.progress(progress);
+    };
+
+    // The timeout starts once the computation is
+    // running, not when it has been queued.
+    if (state->options.timeout > 0)
+      state->token.set_timeout(state->options.timeout);
+
+    CancelScope cancelScope(&state->token);
+    ProgressScope progressScope(&callback);
+    check_cancelled();
+    maxint_t res = (is_nth_prime) ? nth_prime(n, threads) : pi(n, threads);
+    check_cancelled();
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->result = to_string(res);
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->error = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->is_ready = true;
+  }
+
+  state->cv.notify_all();
+
+  if (state->options.completion)
+  {
+    try {
+      state->options.completion(async_result(state));
+    }
+    catch (...)
+    { }
+  }
+}
+
+async_result submit(maxint_t n,
+                    bool is_nth_prime,
+                    const async_options& options)
+{
+  auto state = std::make_shared<async_state>();
+  state->options = options;
+
+  AsyncPool::get().submit([state, n, is_nth_prime](int threads)
+  {
+    run(state, n, is_nth_prime, threads);
+  },
+  [state]
+  {
+    state->token.cancel();
+  }, options.threads);
+
+  return async_result(state);
+}
+
+} // namespace
+
+namespace primecount {
+
+async_result::async_result(std::shared_ptr<async_state> state) :
+  state_(std::move(state))
+{ }
+
+bool async_result::valid() const
+{
+  return (bool) state_;
+}
+
+bool async_result::is_ready() const
+{
+  if (!state_)
+    return false;
+
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->is_ready;
+}
+
+void async_result::wait() const
+{
+  if (!state_)
+    throw primecount_error("async_result: no computation");
+
+  std::unique_lock<std::mutex> lock(state_->mutex);
+  state_->cv.wait(lock, [this] { return state_->is_ready; });
+}
+
+bool async_result::wait_for(double seconds) const
+{
+  if (!state_)
+    throw primecount_error("async_result: no computation");
+
+  auto duration = std::chrono::duration<double>(seconds);
+  std::unique_lock<std::mutex> lock(state_->mutex);
+  return state_->cv.wait_for(lock, duration, [this] { return state_->is_ready; });
+}
+
+std::string async_result::get() const
+{
+  wait();
+  std::lock_guard<std::mutex> lock(state_->mutex);
+
+  if (state_->error)
+    std::rethrow_exception(state_->error);
+
+  return state_->result;
+}
+
+void async_result::cancel() const
+{
+  if (state_)
+    state_->token.cancel();
+}
+
+pc_progress_t async_result::progress() const
+{
+  if (!state_)
+    throw primecount_error("async_result: no computation");
+
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->progress;
+}
+
+async_result pi_async(int64_t x, const async_options& options)
+{
+  return submit(x, false, options);
+}
+
+async_result pi_async(const std::string& x, const async_options& options)
+{
+  return submit(to_maxint(x), false, options);
+}
+
+async_result nth_prime_async(int64_t n, const async_options& options)
+{
+  return submit(n, true, options);
+}
+
+async_result nth_prime_async(const std::string& n, const async_options& options)
+{
+  return submit(to_maxint(n), true, options);
+}
+
+} // namespace
@@ -0,0 +1,80 @@
+///
+/// @file  cancel.cpp
+/// @brief Cooperative cancellation of pi(x) computations.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <cancel.hpp>
+#include <primecount.hpp>
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+
+namespace {
+
+thread_local const primecount::cancel_token* current_token = nullptr;
+
+int64_t get_microseconds()
+{
+  auto now = std::chrono::steady_clock::now();
+  auto time = now.time_since_epoch();
+  auto micro = std::chrono::duration_cast<std::chrono::microseconds>(time);
+  return (int64_t) micro.count();
+}
+
+} // namespace
+
+namespace primecount {
+
+void cancel_token::cancel()
+{
+  cancelled_.store(true, std::memory_order_relaxed);
+}
+
+void cancel_token::set_timeout(double seconds)
+{
+  if (seconds < 0)
+    seconds = 0;
+
+  int64_t deadline = get_microseconds() + (int64_t) (seconds * 1e6);
+  deadline_.store(deadline, std::memory_order_relaxed);
+}
+
+bool cancel_token::is_cancelled() const
+{
+  if (cancelled_.load(std::memory_order_relaxed))
+    return true;
+
+  int64_t deadline = deadline_.load(std::memory_order_relaxed);
+  return deadline > 0 && get_microseconds() >= deadline;
+}
+
+const cancel_token* get_cancel_token()
+{
+  return current_token;
+}
+
+void check_cancelled()
+{
+  if (is_cancelled(current_token))
+    throw primecount_cancelled("computation cancelled");
+}
+
+CancelScope::CancelScope(const cancel_token* token) :
+  old_token_(current_token)
+{
+  if (token)
+    current_token = token;
+}
+
+CancelScope::~CancelScope()
+{
+  current_token = old_token_;
+}
+
+} // namespace
@@ -0,0 +1,58 @@
+///
+/// @file  cancel.hpp
+/// @brief Cooperative cancellation of pi(x) computations.
+///        The cancel_token of the current computation is stored
+///        in a thread local variable by CancelScope. The load
+///        balancers (and the other parallel loops) read the
+///        token of the calling thread when they are created and
+///        stop handing out work once the token has been
+///        cancelled. Afterwards the formula calls
+///        check_cancelled() which throws a primecount_cancelled
+///        exception, this frees all lookup tables of the formula.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef CANCEL_HPP
+#define CANCEL_HPP
+
+#include <primecount.hpp>
+
+namespace primecount {
+
+/// Returns the cancel_token of the computation that is
+/// running in the current thread or nullptr.
+///
+const cancel_token* get_cancel_token();
+
+/// Throws a primecount_cancelled exception if the computation
+/// running in the current thread has been cancelled.
+///
+void check_cancelled();
+
+inline bool is_cancelled(const cancel_token* token)
+{
+  return token && token->is_cancelled();
+}
+
+/// Sets the cancel_token of the current thread
+/// until the object goes out of scope. If token is
+/// nullptr the current token is kept.
+///
+class CancelScope
+{
+public:
+  CancelScope(const cancel_token* token);
+  ~CancelScope();
+  CancelScope(const CancelScope&) = delete;
+  CancelScope& operator=(const CancelScope&) = delete;
+private:
+  const cancel_token* old_token_;
+};
+
+} // namespace
+
+#endif
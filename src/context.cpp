@@ -0,0 +1,101 @@
+///
+/// @file  context.cpp
+/// @brief The context of the pi(x) computation that is running
+///        in the current thread.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <context.hpp>
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <cancel.hpp>
+#include <estimate.hpp>
+#include <int128_t.hpp>
+#include <Progress.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+namespace {
+
+thread_local const primecount::context* current_ctx = nullptr;
+
+} // namespace
+
+namespace primecount {
+
+const context* get_context()
+{
+  return current_ctx;
+}
+
+std::ostream& get_print_stream()
+{
+  if (current_ctx && current_ctx->print_stream)
+    return *current_ctx->print_stream;
+  else
+    return std::cout;
+}
+
+int get_num_threads(const context& ctx, maxint_t x)
+{
+  int threads = ctx.threads;
+  if (threads <= 0)
+    threads = get_num_threads();
+
+  // For x <= 10^8 we use Meissel's algorithm
+  // whose memory usage is negligible.
+  if (ctx.max_memory == 0 ||
+      x <= (maxint_t) 1e8)
+    return threads;
+
+  while (true)
+  {
+    uint64_t bytes = gourdon_peak_memory(gourdon_tables(x, threads));
+    if (bytes <= ctx.max_memory)
+      return threads;
+    if (threads == 1)
+      throw primecount_error("pi(x): estimated memory usage of " + std::to_string(bytes) +
+                             " bytes exceeds max_memory = " + std::to_string(ctx.max_memory) + " bytes");
+    threads = std::max(1, threads / 2);
+  }
+}
+
+ContextScope::ContextScope(const context* ctx) :
+  old_ctx_(current_ctx),
+  cancelScope_(ctx->cancel),
+  progressScope_(&ctx->progress)
+{
+  current_ctx = ctx;
+}
+
+ContextScope::~ContextScope()
+{
+  current_ctx = old_ctx_;
+}
+
+ThreadScope get_thread_scope()
+{
+  return ThreadScope{current_ctx, get_cancel_token(), get_progress_scope()};
+}
+
+InheritScope::InheritScope(const ThreadScope& scope) :
+  old_ctx_(current_ctx),
+  cancelScope_(scope.token),
+  progressScope_(scope.progress)
+{
+  current_ctx = scope.ctx;
+}
+
+InheritScope::~InheritScope()
+{
+  current_ctx = old_ctx_;
+}
+
+} // namespace
@@ -0,0 +1,98 @@
+///
+/// @file  context.hpp
+/// @brief The context of the pi(x) computation that is running
+///        in the current thread. The context is stored in a
+///        thread local variable by ContextScope, the functions
+///        that read the settings (get_alpha_gourdon(),
+///        is_print(), ...) use the settings of the context if
+///        there is one, else the global settings. The settings
+///        are read by the thread that calls the formulas, the
+///        formulas pass them on to their worker threads.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef CONTEXT_HPP
+#define CONTEXT_HPP
+
+#include <primecount.hpp>
+#include <cancel.hpp>
+#include <int128_t.hpp>
+#include <Progress.hpp>
+
+#include <iosfwd>
+
+namespace primecount {
+
+/// Returns the context of the computation that
+/// is running in the current thread or nullptr.
+///
+const context* get_context();
+
+/// Returns the stream used for printing by
+/// the current thread, std::cout by default.
+///
+std::ostream& get_print_stream();
+
+/// Returns the number of threads used to compute pi(x)
+/// with the given context. If the context has a memory
+/// budget we halve the number of threads until the
+/// estimated memory usage fits into the budget.
+///
+int get_num_threads(const context& ctx, maxint_t x);
+
+/// Sets the context (and its progress callback and
+/// cancellation token) of the current thread until
+/// the object goes out of scope.
+///
+class ContextScope
+{
+public:
+  ContextScope(const context* ctx);
+  ~ContextScope();
+  ContextScope(const ContextScope&) = delete;
+  ContextScope& operator=(const ContextScope&) = delete;
+private:
+  const context* old_ctx_;
+  CancelScope cancelScope_;
+  ProgressScope progressScope_;
+};
+
+/// The context, cancellation token and progress callback
+/// of the current thread. These are thread local, hence they
+/// must be captured before handing off work to a thread that
+/// primecount starts itself (e.g. using std::async) and
+/// re-installed in that thread using InheritScope.
+///
+struct ThreadScope
+{
+  const context* ctx;
+  const cancel_token* token;
+  const ProgressCallback* progress;
+};
+
+ThreadScope get_thread_scope();
+
+/// Sets the captured context, cancellation token and
+/// progress callback of the current thread until the
+/// object goes out of scope.
+///
+class InheritScope
+{
+public:
+  InheritScope(const ThreadScope& scope);
+  ~InheritScope();
+  InheritScope(const InheritScope&) = delete;
+  InheritScope& operator=(const InheritScope&) = delete;
+private:
+  const context* old_ctx_;
+  CancelScope cancelScope_;
+  ProgressScope progressScope_;
+};
+
+} // namespace
+
+#endif
@@ -21,6 +21,7 @@
 
 #include <PiTable.hpp>
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
 #include <fast_div.hpp>
 #include <generate_primes.hpp>
 #include <int128_t.hpp>
@@ -30,6 +31,8 @@
 #include <print.hpp>
 #include <RelaxedAtomic.hpp>
 #include <StatusS2.hpp>
+#include <cancel.hpp>
+#include <Progress.hpp>
 #include <S.hpp>
 
 #include <libdivide.h>
@@ -83,10 +86,11 @@ T S2_easy_64(T xp128,
   // pq = primes[b] * primes[l]
   // Which satisfy: pq > z && x / pq <= y
   // where phi(x / pq, b - 1) = pi(x / pq) - b + 2
-  for (; l > pi_min_sparse; l--)
+  if (l > pi_min_sparse)
   {
-    uint64_t xpq = xp / primes[l];
-    sum += pi[xpq] - b + 2;
+    auto xpq = [&](uint64_t i) { return xp / primes[i]; };
+    sum += pi.sum_lookups(pi_min_sparse, l, xpq);
+    sum -= (l - pi_min_sparse) * (b - 2);
   }
 
   return sum;
@@ -134,10 +138,11 @@ T S2_easy_128(T xp,
   // pq = primes[b] * primes[l]
   // Which satisfy: pq > z && x / pq <= y
   // where phi(x / pq, b - 1) = pi(x / pq) - b + 2
-  for (; l > pi_min_sparse; l--)
+  if (l > pi_min_sparse)
   {
-    uint64_t xpq = fast_div64(xp, primes[l]);
-    sum += pi[xpq] - b + 2;
+    auto xpq = [&](uint64_t i) { return fast_div64(xp, primes[i]); };
+    sum += pi.sum_lookups(pi_min_sparse, l, xpq);
+    sum -= (l - pi_min_sparse) * (b - 2);
   }
 
   return sum;
@@ -171,8 +176,12 @@ T S2_easy_OpenMP(T x,
   int max_threads = (int) std::pow(z, 1 / 4.0);
   threads = std::min(threads, max_threads);
   threads = ideal_num_threads(x13, threads, thread_threshold);
+  ThreadLease lease(threads);
+  threads = lease.threads();
 
   StatusS2 status(x);
+  Progress progress("S2_easy");
+  const cancel_token* token = get_cancel_token();
   PiTable pi(y, threads);
   int64_t pi_sqrty = pi[isqrt(y)];
   int64_t pi_x13 = pi[x13];
@@ -182,6 +191,9 @@ T S2_easy_OpenMP(T x,
   #pragma omp parallel num_threads(threads) reduction(+: sum)
   for (int64_t b = min_b++; b <= pi_x13; b = min_b++)
   {
+    if (is_cancelled(token))
+      break;
+
     int64_t prime = primes[b];
     T xp = x / prime;
 
@@ -191,10 +203,16 @@ T S2_easy_OpenMP(T x,
       sum += S2_easy_128(xp, y, z, b, prime, primes, pi);
 
     #pragma omp master
-    if (is_print)
-      status.print(b, pi_x13);
+    {
+      if (is_print)
+        status.print(b, pi_x13);
+      if (progress.is_due(get_time()))
+        progress.report(StatusS2::getPercent(b, pi_x13), 0);
+    }
   }
 
+  check_cancelled();
+
   return sum;
 }
 
@@ -28,6 +28,7 @@
 ///
 
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
 #include <PiTable.hpp>
 #include <FactorTable.hpp>
 #include <Sieve.hpp>
@@ -37,6 +38,7 @@
 #include <imath.hpp>
 #include <int128_t.hpp>
 #include <LoadBalancerS2.hpp>
+#include <cancel.hpp>
 #include <min.hpp>
 #include <print.hpp>
 #include <S.hpp>
@@ -201,8 +203,10 @@ T S2_hard_OpenMP(T x,
   int max_threads = (int) std::pow(z, 1 / 3.7);
   threads = std::min(threads, max_threads);
   threads = ideal_num_threads(z, threads, thread_threshold);
+  ThreadLease lease(threads);
+  threads = lease.threads();
 
-  LoadBalancerS2 loadBalancer(x, z, s2_hard_approx, threads, is_print);
+  LoadBalancerS2 loadBalancer(x, z, s2_hard_approx, threads, is_print, "S2_hard");
   int64_t max_prime = min(y, z / isqrt(y));
   PiTable pi(max_prime, threads);
 
@@ -223,6 +227,7 @@ T S2_hard_OpenMP(T x,
     }
   }
 
+  check_cancelled();
   T sum = (T) loadBalancer.get_sum();
 
   return sum;
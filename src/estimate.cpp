@@ -0,0 +1,363 @@
+///
+/// @file  estimate.cpp
+/// @brief Estimate the runtime and the memory usage of a pi(x)
+///        computation using Xavier Gourdon's algorithm
+///        (option: --estimate).
+///
+///        The runtime is estimated by computing the formulas of
+///        Xavier Gourdon's algorithm for a few smaller x using
+///        the same number of threads. The runtime of each
+///        formula is then extrapolated separately using the
+///        growth rate that has been measured (least squares fit)
+///        using all samples. Hence the estimate takes into account
+///        the user's CPU, its cache sizes and its number of
+///        threads.
+///
+///        The memory usage is calculated from the sizes of the
+///        lookup tables that are allocated by the different
+///        formulas, these sizes are known upfront. Since the
+///        formulas are computed one after another, the peak
+///        memory usage is the memory usage of the formula with
+///        the largest lookup tables.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <estimate.hpp>
+#include <gourdon/FactorTableD.hpp>
+#include <gourdon/SegmentedPiTable.hpp>
+#include <primecount.hpp>
+#include <primecount-config.hpp>
+#include <primecount-internal.hpp>
+#include <gourdon.hpp>
+#include <imath.hpp>
+#include <int128_t.hpp>
+#include <macros.hpp>
+#include <min.hpp>
+#include <PhiTiny.hpp>
+#include <Vector.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+using namespace primecount;
+
+/// Number of formulas in Xavier Gourdon's algorithm,
+/// A and C are computed together.
+constexpr int formulas = 5;
+const Array<const char*, formulas> formula_names = { "Sigma", "Phi0", "AC", "B", "D" };
+
+/// The AC, B and D formulas have a runtime complexity of about
+/// O(x^(2/3) / log(x)^2) whereas the runtime of the Sigma and
+/// Phi0 formulas grows much more slowly. We only allow
+/// measured growth rates that are close to these complexities.
+///
+struct Exponent
+{
+  double min;
+  double expected;
+  double max;
+};
+
+const Array<Exponent, formulas> exponents =
+{{
+  { 0.3, 0.5, 0.7 },
+  { 0.3, 0.5, 0.7 },
+  { 0.58, 2 / 3.0, 0.72 },
+  { 0.58, 2 / 3.0, 0.72 },
+  { 0.58, 2 / 3.0, 0.72 }
+}};
+
+/// We stop sampling once the computation of a
+/// sample takes longer than this number of seconds.
+constexpr double sample_seconds = 1.0;
+
+struct GourdonVars
+{
+  int64_t y;
+  int64_t z;
+  int64_t k;
+};
+
+/// Same as in pi_gourdon_64() and pi_gourdon_128()
+GourdonVars get_gourdon_vars(maxint_t x)
+{
+  auto alpha = get_alpha_gourdon(x);
+  double alpha_y = alpha.first;
+  double alpha_z = alpha.second;
+  maxint_t limit = get_max_x(alpha_y);
+
+  if_unlikely(x > limit)
+    throw primecount_error("estimate(x): x must be <= " + to_string(limit));
+
+  int64_t x13 = iroot<3>(x);
+  int64_t sqrtx = isqrt(x);
+  int64_t y = (int64_t)(x13 * alpha_y);
+
+  // x^(1/3) < y < x^(1/2)
+  y = std::max(y, x13 + 1);
+  y = std::min(y, sqrtx - 1);
+  y = std::max(y, (int64_t) 1);
+
+  int64_t k = PhiTiny::get_k(x);
+  int64_t z = (int64_t)(y * alpha_z);
+
+  // y <= z < x^(1/2)
+  z = std::max(z, y);
+  z = std::min(z, sqrtx - 1);
+  z = std::max(z, (int64_t) 1);
+
+  return GourdonVars{y, z, k};
+}
+
+/// PiTable uses 16 bytes per 240 numbers
+uint64_t pi_table_bytes(maxint_t n)
+{
+  return (uint64_t) (n / 240 + 1) * 16;
+}
+
+/// Size of a vector of all primes <= n
+uint64_t primes_bytes(int64_t n, std::size_t sizeof_prime)
+{
+  if (n < 2)
+    return sizeof_prime;
+
+  int64_t pix = RiemannR(n);
+  return (uint64_t) (pix + 1) * sizeof_prime;
+}
+
+/// Compute all formulas of Xavier Gourdon's
+/// algorithm and measure their runtime.
+///
+Array<double, formulas> sample(int64_t x, int threads)
+{
+  GourdonVars vars = get_gourdon_vars(x);
+  int64_t y = vars.y;
+  int64_t z = vars.z;
+  int64_t k = vars.k;
+  Array<double, formulas> seconds;
+
+  double time = get_time();
+  int64_t sigma = Sigma(x, y, threads, false);
+  seconds[0] = get_time() - time;
+
+  time = get_time();
+  int64_t phi0 = Phi0(x, y, z, k, threads, false);
+  seconds[1] = get_time() - time;
+
+  time = get_time();
+  int64_t ac = AC(x, y, z, k, threads, false);
+  seconds[2] = get_time() - time;
+
+  time = get_time();
+  int64_t b = B(x, y, threads, false);
+  seconds[3] = get_time() - time;
+
+  int64_t d_approx = D_approx((int64_t) Li(x), sigma, phi0, ac, b);
+  time = get_time();
+  D(x, y, z, k, d_approx, threads, false);
+  seconds[4] = get_time() - time;
+
+  return seconds;
+}
+
+double total(const Array<double, formulas>& seconds)
+{
+  double sum = 0;
+  for (double secs : seconds)
+    sum += secs;
+  return sum;
+}
+
+} // namespace
+
+namespace primecount {
+
+/// Sizes of the lookup tables allocated by the
+/// formulas of Xavier Gourdon's algorithm.
+///
+Vector<EstimateTable> gourdon_tables(maxint_t x, int threads)
+{
+  Vector<EstimateTable> tables;
+  if (x < 2)
+    return tables;
+
+  GourdonVars vars = get_gourdon_vars(x);
+  int64_t y = vars.y;
+  int64_t z = vars.z;
+  int64_t x_star = get_x_star_gourdon(x, y);
+  int64_t xy = (int64_t) (x / y);
+  int64_t xz = (int64_t) (x / z);
+  std::size_t sizeof_prime = (x <= pstd::numeric_limits<int64_t>::max()) ? 4 : 8;
+  threads = std::max(threads, 1);
+
+  maxint_t max_pix_sigma = max3(x / (x_star * y), (maxint_t) y, isqrt(x / x_star));
+  tables.push_back(EstimateTable{"PiTable", "Sigma", pi_table_bytes(max_pix_sigma)});
+  tables.push_back(EstimateTable{"primes", "Phi0", primes_bytes(y, sizeof_prime)});
+
+  int64_t max_a_prime = (int64_t) isqrt(x / x_star);
+  int64_t max_prime = std::max(max_a_prime, y);
+  uint64_t segmented_pi_table = L1_CACHE_SIZE * 2;
+  sizeof_prime = (max_prime <= pstd::numeric_limits<uint32_t>::max()) ? 4 : 8;
+  tables.push_back(EstimateTable{"PiTable", "AC", pi_table_bytes(std::max(z, max_a_prime))});
+  tables.push_back(EstimateTable{"primes", "AC", primes_bytes(max_prime, sizeof_prime)});
+  tables.push_back(EstimateTable{"SegmentedPiTable", "AC", segmented_pi_table * threads});
+
+  // When using multi-threading LoadBalancerAC stores
+  // PrimePi(low - 1) for all segment boundaries.
+  if (threads > 1)
+  {
+    int64_t sqrtx = (int64_t) isqrt(x);
+    int64_t min_segment_size = (1 << 9) * SegmentedPiTable::numbers_per_byte();
+    int64_t grid_size = std::max(isqrt(sqrtx), min_segment_size);
+    uint64_t segment_counts = ceil_div(sqrtx, grid_size) * sizeof(int64_t);
+    tables.push_back(EstimateTable{"segment counts", "AC", segment_counts});
+  }
+
+  // Each thread uses a primesieve::iterator
+  // with sieving primes <= sqrt(x / y).
+  uint64_t sieving_primes = primes_bytes(isqrt(xy), 8);
+  tables.push_back(EstimateTable{"sieving primes", "B", sieving_primes * threads});
+
+  std::size_t sizeof_factor = (z <= FactorTableD<uint16_t, true>::max()) ? 2 : 4;
+  uint64_t factor_table = (uint64_t) (BaseFactorTable::to_index(z) + 1) * sizeof_factor;
+  sizeof_prime = (z <= FactorTableD<uint16_t>::max()) ? 4 : 8;
+  uint64_t sieve = std::max((uint64_t) L2_CACHE_SIZE, (uint64_t) isqrt(xz) / 30);
+  tables.push_back(EstimateTable{"FactorTableD", "D", factor_table});
+  tables.push_back(EstimateTable{"PiTable", "D", pi_table_bytes(y)});
+  tables.push_back(EstimateTable{"primes", "D", primes_bytes(y, sizeof_prime)});
+  tables.push_back(EstimateTable{"Sieve", "D", sieve * threads});
+
+  return tables;
+}
+
+/// The formulas are computed one after another,
+/// hence the peak memory usage is the memory
+/// usage of the formula with the largest tables.
+///
+uint64_t gourdon_peak_memory(const Vector<EstimateTable>& tables)
+{
+  uint64_t peak = 0;
+
+  for (const char* formula : formula_names)
+  {
+    uint64_t bytes = 0;
+    for (const auto& table : tables)
+      if (std::strcmp(table.formula, formula) == 0)
+        bytes += table.bytes;
+    peak = std::max(peak, bytes);
+  }
+
+  return peak;
+}
+
+/// Estimate the runtime and the memory usage of
+/// pi(x) using Xavier Gourdon's algorithm.
+///
+Estimate estimate(maxint_t x, int threads)
+{
+  Estimate est;
+  est.x = x;
+  est.threads = threads;
+
+  if (x < 2)
+    return est;
+
+  GourdonVars vars = get_gourdon_vars(x);
+  est.y = vars.y;
+  est.z = vars.z;
+  est.tables = gourdon_tables(x, threads);
+  est.peak_memory = gourdon_peak_memory(est.tables);
+
+  struct Sample
+  {
+    maxint_t x;
+    Array<double, formulas> seconds;
+  };
+
+  Vector<Sample> samples;
+  maxint_t xs = min(x, (maxint_t) 1e12);
+
+  // Compute pi(10^12), pi(10^13), ... until a
+  // sample takes more than sample_seconds.
+  while (true)
+  {
+    samples.push_back(Sample{xs, sample((int64_t) xs, threads)});
+
+    if (xs == x ||
+        total(samples.back().seconds) >= sample_seconds)
+      break;
+
+    xs *= 10;
+
+    if (xs >= x)
+    {
+      if (x > pstd::numeric_limits<int64_t>::max())
+        break;
+      xs = x;
+    }
+  }
+
+  // If x > 2^63 the last sample is < x
+  maxint_t sample_x = samples.back().x;
+  est.sample_x = sample_x;
+  est.sample_seconds = total(samples.back().seconds);
+
+  for (int i = 0; i < formulas; i++)
+  {
+    double seconds = samples.back().seconds[i];
+
+    if (sample_x < x)
+    {
+      // Least squares fit: log(seconds) = c + exponent * log(x).
+      // Timings below 1 millisecond are unreliable.
+      double n = 0;
+      double sx = 0;
+      double sy = 0;
+      double sxx = 0;
+      double sxy = 0;
+
+      for (const auto& sample : samples)
+      {
+        if (sample.seconds[i] >= 0.001)
+        {
+          double lx = std::log((double) sample.x);
+          double ly = std::log(sample.seconds[i]);
+          n += 1;
+          sx += lx;
+          sy += ly;
+          sxx += lx * lx;
+          sxy += lx * ly;
+        }
+      }
+
+      double exponent = exponents[i].expected;
+      double denominator = n * sxx - sx * sx;
+      if (n >= 2 && denominator > 0)
+        exponent = (n * sxy - sx * sy) / denominator;
+      exponent = in_between(exponents[i].min, exponent, exponents[i].max);
+
+      if (n >= 1)
+      {
+        double c = (sy - exponent * sx) / n;
+        seconds = std::exp(c + exponent * std::log((double) x));
+      }
+      else
+        seconds *= std::pow((double) x / (double) sample_x, exponent);
+    }
+
+    est.formulas.push_back(EstimateFormula{formula_names[i], seconds});
+    est.seconds += seconds;
+  }
+
+  return est;
+}
+
+} // namespace
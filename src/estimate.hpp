@@ -0,0 +1,56 @@
+///
+/// @file  estimate.hpp
+/// @brief Estimate the runtime and the memory usage of a pi(x)
+///        computation using Xavier Gourdon's algorithm.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef ESTIMATE_HPP
+#define ESTIMATE_HPP
+
+#include <int128_t.hpp>
+#include <Vector.hpp>
+
+#include <stdint.h>
+
+namespace primecount {
+
+struct EstimateFormula
+{
+  const char* name;
+  double seconds = 0;
+};
+
+struct EstimateTable
+{
+  const char* name;
+  const char* formula;
+  uint64_t bytes = 0;
+};
+
+struct Estimate
+{
+  maxint_t x = 0;
+  int64_t y = 0;
+  int64_t z = 0;
+  int threads = 0;
+  /// Largest x that has been computed for the estimate
+  maxint_t sample_x = 0;
+  double sample_seconds = 0;
+  double seconds = 0;
+  uint64_t peak_memory = 0;
+  Vector<EstimateFormula> formulas;
+  Vector<EstimateTable> tables;
+};
+
+Estimate estimate(maxint_t x, int threads);
+Vector<EstimateTable> gourdon_tables(maxint_t x, int threads);
+uint64_t gourdon_peak_memory(const Vector<EstimateTable>& tables);
+
+} // namespace
+
+#endif
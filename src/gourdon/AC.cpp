@@ -30,6 +30,8 @@
 
 #include <PiTable.hpp>
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
+#include <cancel.hpp>
 #include <fast_div.hpp>
 #include <generate_primes.hpp>
 #include <gourdon.hpp>
@@ -217,10 +219,12 @@ T AC_OpenMP(T x,
   // These load balancing settings work well on my
   // dual-socket AMD EPYC 7642 server with 192 CPU cores.
   int64_t thread_threshold = 1000;
-  int max_threads = (int) std::pow(xz, 1 / 3.7);
+  int max_threads = get_max_threads_AC(xz);
   threads = min(threads, max_threads);
   threads = ideal_num_threads(x13, threads, thread_threshold);
-  LoadBalancerAC loadBalancer(sqrtx, y, threads, is_print);
+  ThreadLease lease(threads);
+  threads = lease.threads();
+  LoadBalancerAC loadBalancer(sqrtx, y, threads, is_print, "AC");
 
   // PiTable's size = z because of the C1 formula.
   // PiTable is accessed much less frequently than
@@ -279,7 +283,7 @@ T AC_OpenMP(T x,
         // Current segment [low, high[
         int64_t high = low + segment_size;
         high = min(high, sqrtx);
-        segmentedPi.init(low, high);
+        segmentedPi.init(low, high, thread.pi_low);
 
         // We measure the thread computation time excluding the
         // first expensive initialization of the segmentedPi
@@ -319,6 +323,8 @@ T AC_OpenMP(T x,
     }
   }
 
+  check_cancelled();
+
   return sum;
 }
 
@@ -18,9 +18,11 @@
 
 #include <gourdon.hpp>
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
 #include <primesieve.hpp>
 #include <int128_t.hpp>
 #include <LoadBalancerP2.hpp>
+#include <cancel.hpp>
 #include <macros.hpp>
 #include <min.hpp>
 #include <imath.hpp>
@@ -95,7 +97,8 @@ T B_OpenMP(T x,
 
   T sum = 0;
   int64_t xy = (int64_t)(x / max(y, 1));
-  LoadBalancerP2 loadBalancer(x, xy, threads, is_print);
+  ThreadLease lease(threads);
+  LoadBalancerP2 loadBalancer(x, xy, lease.threads(), is_print, "B");
   threads = loadBalancer.get_threads();
 
   // for (low = sqrt(x); low < x / y; low += dist)
@@ -106,6 +109,8 @@ T B_OpenMP(T x,
       sum += B_thread(x, y, low, high);
   }
 
+  check_cancelled();
+
   return sum;
 }
 
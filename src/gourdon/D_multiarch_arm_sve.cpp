@@ -30,9 +30,11 @@
 #include "FactorTableD.hpp"
 
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
 #include <PiTable.hpp>
 #include <Sieve.hpp>
 #include <LoadBalancerS2.hpp>
+#include <cancel.hpp>
 #include <fast_div.hpp>
 #include <generate_primes.hpp>
 #include <phi_vector.hpp>
@@ -117,13 +119,14 @@ T D_thread(T x,
 
       min_m = factor.to_index(min_m);
       max_m = factor.to_index(max_m);
+      int64_t leaf_key = factor.leaf_key(b, prime);
 
       for (int64_t m = max_m; m > min_m; m--)
       {
         // mu[m] != 0 && 
         // lpf[m] > prime &&
         // mpf[m] <= y
-        if (prime < factor.is_leaf(m))
+        if (leaf_key < factor.is_leaf(m))
         {
           int64_t xpm = fast_div64(xp, factor.to_number(m));
           int64_t count = sieve.count_arm_sve(xpm - low);
@@ -207,10 +210,12 @@ T D_OpenMP(T x,
   // These load balancing settings work well on my
   // dual-socket AMD EPYC 7642 server with 192 CPU cores.
   int64_t thread_threshold = 1 << 20;
-  int max_threads = (int) std::pow(xz, 1 / 3.7);
+  int max_threads = get_max_threads_D(xz);
   threads = std::min(threads, max_threads);
   threads = ideal_num_threads(xz, threads, thread_threshold);
-  LoadBalancerS2 loadBalancer(x, xz, d_approx, threads, is_print);
+  ThreadLease lease(threads);
+  threads = lease.threads();
+  LoadBalancerS2 loadBalancer(x, xz, d_approx, threads, is_print, "D");
   PiTable pi(y, threads);
 
   #pragma omp parallel num_threads(threads)
@@ -230,6 +235,7 @@ T D_OpenMP(T x,
     }
   }
 
+  check_cancelled();
   T sum = (T) loadBalancer.get_sum();
 
   return sum;
@@ -298,6 +304,13 @@ int128_t D_multiarch_arm_sve(int128_t x,
     auto primes = generate_primes<uint32_t>(y);
     sum = D_OpenMP(x, y, z, k, d_approx, primes, factor, threads, is_print);
   }
+  // lpf > 2^16, store pi[lpf] instead
+  else if (z <= FactorTableD<uint16_t, true>::max())
+  {
+    FactorTableD<uint16_t, true> factor(y, z, threads);
+    auto primes = generate_primes<int64_t>(y);
+    sum = D_OpenMP(x, y, z, k, d_approx, primes, factor, threads, is_print);
+  }
   else
   {
     FactorTableD<uint32_t> factor(y, z, threads);
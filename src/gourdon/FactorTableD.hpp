@@ -37,6 +37,13 @@
 ///        * Old: if (mu[n] != 0 && lpf[n] > prime && mpf[n] <= y)
 ///        * New: if (prime < factor[n])
 ///
+///        For z > 2^32 the factor[n] lookup table needs 4 bytes per
+///        entry because lpf[n] may be > 2^16. Therefore we also
+///        support storing 2 * pi[lpf] + 1 (instead of lpf) which
+///        fits into 2 bytes for z < 386083^2 (~ 1.49 * 10^11). The
+///        D formula then compares prime indexes instead of primes:
+///        if (2 * b + 1 < factor[n]) with prime = primes[b].
+///
 /// Copyright (C) 2023 Kim Walisch, <kim.walisch@gmail.com>
 ///
 /// This file is distributed under the BSD License. See the COPYING
@@ -49,7 +56,6 @@
 #include <primecount.hpp>
 #include <primecount-internal.hpp>
 #include <BaseFactorTable.hpp>
-#include <primesieve.hpp>
 #include <imath.hpp>
 #include <int128_t.hpp>
 #include <macros.hpp>
@@ -62,9 +68,15 @@ namespace {
 
 using namespace primecount;
 
-template <typename T>
+/// @PrimeIndex: If true factor[n] stores 2 * pi[lpf] + 1
+///              instead of lpf (in case mu(n) = -1).
+///
+template <typename T, bool PrimeIndex = false>
 class FactorTableD : public BaseFactorTable
 {
+  static_assert(!PrimeIndex || sizeof(T) == sizeof(uint16_t),
+                "PrimeIndex requires a 16-bit factor table");
+
 public:
   /// Factor numbers <= z
   FactorTableD(int64_t y,
@@ -75,108 +87,7 @@ public:
       throw primecount_error("z must be <= FactorTable::max()");
 
     z = std::max<int64_t>(1, z);
-    T T_MAX = pstd::numeric_limits<T>::max();
-    factor_.resize(to_index(z) + 1);
-
-    // mu(1) = 1.
-    // 1 has zero prime factors, hence 1 has an even
-    // number of prime factors. We use the least
-    // significant bit to indicate whether the number
-    // has an even or odd number of prime factors.
-    factor_[0] = T_MAX ^ 1;
-
-    int64_t sqrtz = isqrt(z);
-    int64_t thread_threshold = (int64_t) 1e7;
-    threads = ideal_num_threads(z, threads, thread_threshold);
-    int64_t thread_distance = ceil_div(z, threads);
-    thread_distance += coprime_indexes_.size() - thread_distance % coprime_indexes_.size();
-
-    #pragma omp parallel for num_threads(threads)
-    for (int t = 0; t < threads; t++)
-    {
-      // Thread processes interval [low, high]
-      int64_t low = thread_distance * t;
-      int64_t high = low + thread_distance;
-      low = std::max(first_coprime(), low + 1);
-      high = std::min(high, z);
-
-      if (low <= high)
-      {
-        // Default initialize memory to all bits set
-        int64_t low_idx = to_index(low);
-        int64_t size = (to_index(high) + 1) - low_idx;
-        std::fill_n(&factor_[low_idx], size, T_MAX);
-
-        int64_t start = first_coprime();
-        int64_t stop = high / first_coprime();
-        int64_t min_m = first_coprime() * first_coprime();
-        primesieve::iterator it(start, stop);
-
-        if (min_m <= high)
-        {
-          while (true)
-          {
-            // Find multiples > prime
-            int64_t i = 1;
-            int64_t prime = it.next_prime();
-            int64_t multiple = next_multiple(prime, low, &i);
-            min_m = prime * first_coprime();
-
-            if (min_m > high)
-              break;
-
-            for (; multiple <= high; multiple = prime * to_number(i++))
-            {
-              int64_t mi = to_index(multiple);
-              // prime is the smallest factor of multiple
-              if (factor_[mi] == T_MAX)
-                factor_[mi] = (T) prime;
-              // the least significant bit indicates
-              // whether multiple has an even (0) or odd (1)
-              // number of prime factors
-              else if (factor_[mi] != 0)
-                factor_[mi] ^= 1;
-            }
-
-            if (prime <= sqrtz)
-            {
-              int64_t j = 0;
-              int64_t square = prime * prime;
-              multiple = next_multiple(square, low, &j);
-
-              // Sieve out numbers that are not square free
-              // i.e. numbers for which moebius(n) = 0.
-              for (; multiple <= high; multiple = square * to_number(j++))
-                factor_[to_index(multiple)] = 0;
-            }
-          }
-        }
-
-        // Iterate over primes from [y+1, high]
-        start = std::max(start, y + 1);
-
-        if (start <= high)
-        {
-          it.jump_to(start, high);
-
-          // y < prime <= z
-          while (true)
-          {
-            int64_t i = 0;
-            int64_t prime = it.next_prime();
-            int64_t next = next_multiple(prime, low, &i);
-
-            if (prime > high)
-              break;
-
-            // Sieve out primes > y &&
-            // Sieve out numbers with prime factors > y
-            for (; next <= high; next = prime * to_number(i++))
-              factor_[to_index(next)] = 0;
-          }
-        }
-      }
-    }
+    init_factor(factor_, y, z, threads, PrimeIndex);
   }
 
   /// Returns true if n (with n = to_number(index)) is a
@@ -197,6 +108,14 @@ public:
     return factor_[index];
   }
 
+  /// n = to_number(index) is a hard special leaf for the
+  /// prime = primes[b] if leaf_key(b, prime) < is_leaf(index).
+  ///
+  static int64_t leaf_key(int64_t b, int64_t prime)
+  {
+    return PrimeIndex ? b * 2 + 1 : prime;
+  }
+
   /// Get the Möbius function value of the number
   /// n = to_number(index).
   ///
@@ -225,6 +144,12 @@ public:
   static maxint_t max()
   {
     maxint_t T_MAX = pstd::numeric_limits<T>::max();
+
+    // 2 * pi[lpf] + 1 <= T_MAX - 2 = 65533 requires
+    // lpf < 386083 = nth_prime(32767).
+    if (PrimeIndex)
+      return ipow<2>((maxint_t) 386083) - 1;
+
     return ipow<2>(T_MAX - 1) - 1;
   }
 
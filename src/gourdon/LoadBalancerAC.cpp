@@ -18,7 +18,11 @@
 
 #include <primecount-config.hpp>
 #include <primecount-internal.hpp>
+#include <context.hpp>
 #include <imath.hpp>
+#include <macros.hpp>
+#include <popcnt.hpp>
+#include <primesieve/sieve_bits.hpp>
 
 #include <stdint.h>
 #include <algorithm>
@@ -30,11 +34,16 @@ namespace primecount {
 LoadBalancerAC::LoadBalancerAC(int64_t sqrtx,
                                int64_t y,
                                int threads,
-                               bool is_print) :
+                               bool is_print,
+                               const char* formula) :
   sqrtx_(sqrtx),
   y_(y),
   threads_(threads),
-  is_print_(is_print)
+  is_print_(is_print),
+  out_(&get_print_stream()),
+  progress_(formula),
+  cancel_token_(get_cancel_token()),
+  lease_(ThreadLease::get_current())
 {
   lock_.init(threads);
   int64_t x14 = isqrt(sqrtx);
@@ -49,7 +58,10 @@ LoadBalancerAC::LoadBalancerAC(int64_t sqrtx,
   // hits and we get good performance.
   int64_t L1_segment_size = L1_CACHE_SIZE * SegmentedPiTable::numbers_per_byte();
 
-  if (threads == 1 && !is_print)
+  if (threads == 1 &&
+      !is_print &&
+      !progress_.is_enabled() &&
+      !cancel_token_)
   {
     // When using a single thread (and printing is disabled)
     // we can use a segment size larger than x^(1/4)
@@ -70,7 +82,18 @@ LoadBalancerAC::LoadBalancerAC(int64_t sqrtx,
   segment_size_ = std::max(min_segment_size, segment_size_);
   segment_size_ = SegmentedPiTable::align_segment_size(segment_size_);
   max_segment_size_ = std::max(L1_segment_size, segment_size_);
-  max_segment_size_ = SegmentedPiTable::align_segment_size(max_segment_size_);
+
+  // The segment size only ever grows by a factor of 2 up to
+  // max_segment_size_. Hence if max_segment_size_ is a multiple
+  // of the initial segment size, then all segment boundaries
+  // are multiples of the initial segment size.
+  grid_size_ = segment_size_;
+  max_segment_size_ -= max_segment_size_ % grid_size_;
+
+  // When using multi-threading the threads process segments
+  // that are not adjacent to their previous segments.
+  if (threads > 1)
+    init_pi_low(threads);
 
   if (is_print_)
     print_status(get_time());
@@ -78,11 +101,42 @@ LoadBalancerAC::LoadBalancerAC(int64_t sqrtx,
 
 bool LoadBalancerAC::get_work(ThreadDataAC& thread)
 {
+  // Stop handing out work once the
+  // computation has been cancelled.
+  if (is_cancelled(cancel_token_))
+    return false;
+
   double time = get_time();
   thread.secs = time - thread.secs;
+  double percent = -1;
+  bool is_work;
+
+  {
+    LockGuard lockGuard(lock_);
+
+    // Return the thread to the library wide thread budget
+    // if concurrent computations oversubscribe it.
+    if (lease_ && lease_->release_thread())
+      return false;
+
+    is_work = get_work_locked(thread, time);
+
+    // Only take a snapshot of the progress here, the
+    // progress callback is called after the lock has
+    // been released.
+    if (is_work &&
+        progress_.is_due(time))
+      percent = get_percent(thread.low);
+  }
 
-  LockGuard lockGuard(lock_);
+  if (percent >= 0)
+    progress_.report(percent, 0);
 
+  return is_work;
+}
+
+bool LoadBalancerAC::get_work_locked(ThreadDataAC& thread, double time)
+{
   if (low_ >= sqrtx_)
     return false;
   if (low_ == 0)
@@ -127,12 +181,96 @@ bool LoadBalancerAC::get_work(ThreadDataAC& thread)
   thread.low = low_;
   thread.segments = segments_;
   thread.segment_size = segment_size_;
+  thread.pi_low = -1;
+
+  if (!pi_low_.empty())
+  {
+    ASSERT(low_ % grid_size_ == 0);
+    thread.pi_low = pi_low_[low_ / grid_size_];
+  }
+
   low_ = std::min(low_ + segment_size_ * segments_, sqrtx_);
   segment_nr_++;
 
   return thread.low < sqrtx_;
 }
 
+/// Compute PrimePi(low - 1) for all segment boundaries
+/// low = i * grid_size_ < sqrt(x). Without this table each
+/// thread would have to compute PrimePi(low - 1) using
+/// pi_noprint() whenever it is assigned a segment that is not
+/// adjacent to its previous segment. Counting the primes
+/// <= sqrt(x) using a single parallel sieving pass is much
+/// cheaper, afterwards each segment starts in O(1).
+///
+void LoadBalancerAC::init_pi_low(int threads)
+{
+  int64_t blocks = ceil_div(sqrtx_, grid_size_);
+  int64_t block_words = grid_size_ / 240;
+  int64_t thread_threshold = (int64_t) 1e7;
+  threads = ideal_num_threads(sqrtx_, threads, thread_threshold);
+
+  // Sieve about 2^16 words (~ 16 million numbers) at once
+  int64_t chunk_blocks = std::max((int64_t) 1, (1 << 16) / block_words);
+  int64_t chunks = ceil_div(blocks, chunk_blocks);
+  pi_low_.resize(blocks);
+  pi_low_[0] = 0;
+
+  #pragma omp parallel num_threads(threads)
+  {
+    Vector<uint64_t> bits;
+
+    // pi_low_[b + 1] = number of primes >= 7 inside block b
+    #pragma omp for schedule(dynamic)
+    for (int64_t i = 0; i < chunks; i++)
+    {
+      int64_t first = i * chunk_blocks;
+      int64_t last = std::min(first + chunk_blocks, blocks - 1);
+      int64_t low = first * grid_size_;
+      int64_t high = last * grid_size_;
+
+      if (low < high)
+      {
+        bits.resize((high - low) / 240);
+        primesieve::sieve_bits(low, high, bits.data());
+
+        for (int64_t b = first; b < last; b++)
+        {
+          int64_t count = 0;
+          int64_t j = (b - first) * block_words;
+          for (int64_t k = j; k < j + block_words; k++)
+            count += popcnt64(bits[k]);
+          pi_low_[b + 1] = count;
+        }
+      }
+    }
+  }
+
+  // The first block contains the primes 2, 3 and 5
+  // which are not part of our bit arrays.
+  if (blocks > 1)
+    pi_low_[1] += 3;
+
+  for (int64_t b = 1; b < blocks; b++)
+    pi_low_[b] += pi_low_[b - 1];
+}
+
+/// Used for the progress reports. Most of the work of the
+/// A & C formulas is located below y, the work density is
+/// nearly constant below y and very low above y. Hence we
+/// estimate that about 80% of the work is located below y.
+///
+double LoadBalancerAC::get_percent(int64_t low) const
+{
+  double below_y = 80;
+  double percent = below_y * ::get_percent(std::min(low, y_), y_);
+
+  if (low > y_)
+    percent += (100 - below_y) * ::get_percent(low - y_, sqrtx_ - y_);
+
+  return percent / 100;
+}
+
 void LoadBalancerAC::print_status(double time)
 {
   double threshold = 0.1;
@@ -150,12 +288,12 @@ void LoadBalancerAC::print_status(double time)
     status << "\rSegments: " << segment_nr_ << '/' << total_segments;
 
     if (status.str().size() >= prev_status_size_)
-      std::cout << status.str() << std::flush;
+      *out_ << status.str() << std::flush;
     else
     {
       std::ostringstream clear_status;
       clear_status << "\r" << std::string(prev_status_size_, ' ') << status.str();
-      std::cout << clear_status.str() << std::flush;
+      *out_ << clear_status.str() << std::flush;
     }
 
     prev_status_size_ = status.str().size();
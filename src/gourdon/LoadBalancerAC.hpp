@@ -17,9 +17,14 @@
 #define LOADBALANCERAC_HPP
 
 #include <OmpLock.hpp>
+#include <cancel.hpp>
+#include <Progress.hpp>
+#include <ThreadLease.hpp>
+#include <Vector.hpp>
 
 #include <stdint.h>
 #include <cstddef>
+#include <iosfwd>
 
 namespace primecount {
 
@@ -28,17 +33,22 @@ struct ThreadDataAC
   int64_t low = 0;
   int64_t segments = 0;
   int64_t segment_size = 0;
+  /// PrimePi(low - 1) or -1 if unknown
+  int64_t pi_low = -1;
   double secs = 0;
 };
 
 class LoadBalancerAC
 {
 public:
-  LoadBalancerAC(int64_t sqrtx, int64_t y, int threads, bool is_print);
+  LoadBalancerAC(int64_t sqrtx, int64_t y, int threads, bool is_print, const char* formula);
   bool get_work(ThreadDataAC& thread);
 
 private:
+  bool get_work_locked(ThreadDataAC& thread, double time);
+  void init_pi_low(int threads);
   void print_status(double current_time);
+  double get_percent(int64_t low) const;
   int64_t low_ = 0;
   int64_t sqrtx_ = 0;
   int64_t y_ = 0;
@@ -46,11 +56,19 @@ private:
   int64_t segment_size_ = 0;
   int64_t segment_nr_ = 0;
   int64_t max_segment_size_ = 0;
+  /// All segment boundaries are multiples of grid_size_
+  int64_t grid_size_ = 0;
+  /// pi_low_[i] = PrimePi(i * grid_size_ - 1)
+  Vector<int64_t> pi_low_;
   std::size_t prev_status_size_ = 0;
   double start_time_ = 0;
   double print_time_ = 0;
   int threads_ = 0;
   bool is_print_ = false;
+  std::ostream* out_;
+  Progress progress_;
+  const cancel_token* cancel_token_ = nullptr;
+  const ThreadLease* lease_ = nullptr;
   OmpLock lock_;
 };
 
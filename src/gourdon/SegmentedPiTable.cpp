@@ -27,7 +27,7 @@
 #include "SegmentedPiTable.hpp"
 
 #include <primecount-internal.hpp>
-#include <primesieve.hpp>
+#include <primesieve/sieve_bits.hpp>
 #include <imath.hpp>
 #include <macros.hpp>
 #include <min.hpp>
@@ -37,7 +37,12 @@
 
 namespace primecount {
 
-void SegmentedPiTable::init(uint64_t low, uint64_t high)
+/// @pi_low_minus_1: PrimePi(low - 1) if it is known
+/// (e.g. from the LoadBalancerAC) or -1 otherwise.
+///
+void SegmentedPiTable::init(uint64_t low,
+                            uint64_t high,
+                            int64_t pi_low_minus_1)
 {
   ASSERT(low < high);
   ASSERT(low % 240 == 0);
@@ -49,11 +54,15 @@ void SegmentedPiTable::init(uint64_t low, uint64_t high)
   // at the start of each newly assigned segment from the
   // LoadBalancer. However if a thread processes consecutive
   // segments, then we can compute PrimePi[low] in O(1) by
-  // getting that value from the previous segment.
+  // getting that value from the previous segment. When using
+  // multi-threading the LoadBalancerAC precomputes PrimePi[low]
+  // for all segment boundaries.
   if (low <= 5)
     pi_low = pi_tiny_[5];
   else if (low == high_)
     pi_low = operator[](low - 1);
+  else if (pi_low_minus_1 >= 0)
+    pi_low = pi_low_minus_1;
   else
     pi_low = pi_noprint(low - 1, threads);
 
@@ -70,24 +79,14 @@ void SegmentedPiTable::init(uint64_t low, uint64_t high)
   init_count(pi_low);
 }
 
-/// Init pi[x] lookup table for [low, high[
+/// Init pi[x] lookup table for [low, high[. primesieve
+/// sieves the primes >= 7 directly into the bits of our
+/// pi[x] lookup table, this is much faster than iterating
+/// over the primes using primesieve::iterator.
+///
 void SegmentedPiTable::init_bits()
 {
-  // Iterate over primes >= 7
-  uint64_t low = max(low_, 7);
-  if (low >= high_)
-    return;
-
-  primesieve::iterator it(low, high_);
-  uint64_t prime = 0;
-
-  // For each prime in [low, high[ set the
-  // corresponding bit in the pi[x] lookup table.
-  while ((prime = it.next_prime()) < high_)
-  {
-    uint64_t p = prime - low_;
-    pi_[p / 240].bits |= set_bit_[p % 240];
-  }
+  primesieve::sieve_bits(low_, high_, &pi_[0].bits, sizeof(pi_t) / sizeof(uint64_t));
 }
 
 void SegmentedPiTable::init_count(uint64_t pi_low)
@@ -40,7 +40,7 @@ namespace primecount {
 class SegmentedPiTable : public BitSieve240
 {
 public:
-  void init(uint64_t low, uint64_t high);
+  void init(uint64_t low, uint64_t high, int64_t pi_low_minus_1 = -1);
 
   int64_t low() const
   {
@@ -25,10 +25,12 @@
 ///
 
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
 #include <Sieve.hpp>
 #include <generate_primes.hpp>
 #include <phi_vector.hpp>
 #include <LoadBalancerS2.hpp>
+#include <cancel.hpp>
 #include <min.hpp>
 #include <imath.hpp>
 #include <PhiTiny.hpp>
@@ -191,7 +193,9 @@ int64_t S2(int64_t x,
   int max_threads = (int) std::pow(z, 1 / 3.7);
   threads = std::min(threads, max_threads);
   threads = ideal_num_threads(z, threads, thread_threshold);
-  LoadBalancerS2 loadBalancer(x, z, s2_approx, threads, is_print);
+  ThreadLease lease(threads);
+  threads = lease.threads();
+  LoadBalancerS2 loadBalancer(x, z, s2_approx, threads, is_print, "S2");
   PiTable pi(y, threads);
 
   #pragma omp parallel num_threads(threads)
@@ -206,6 +210,7 @@ int64_t S2(int64_t x,
     }
   }
 
+  check_cancelled();
   int64_t sum = (int64_t) loadBalancer.get_sum();
 
   if (is_print)
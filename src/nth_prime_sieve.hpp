@@ -18,6 +18,14 @@
 ///        of our sieving algorithm does not deteriorate the overall
 ///        runtime complexity of our nth prime algorithm.
 ///
+///        The multiples of the sieving primes are crossed off
+///        using a modulo 30 wheel, i.e. we skip the multiples
+///        whose quotient is divisible by 2, 3 or 5. Each thread
+///        stores its small sieving primes together with their
+///        position in the wheel and carries them over to its
+///        next segment, hence small sieving primes do not need
+///        to be regenerated in each segment.
+///
 /// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
 ///
 /// This file is distributed under the BSD License. See the COPYING
@@ -33,6 +41,7 @@
 #include <primecount.hpp>
 #include <primecount-config.hpp>
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
 #include <primesieve.hpp>
 #include <ctz.hpp>
 #include <imath.hpp>
@@ -52,6 +61,42 @@ namespace {
 
 using namespace primecount;
 
+/// Distance to the next quotient coprime to 30
+const Array<uint8_t, 30> next_coprime =
+{
+  1, 0, 5, 4, 3, 2, 1, 0, 3, 2, 1, 0, 1, 0, 3,
+  2, 1, 0, 1, 0, 3, 2, 1, 0, 5, 4, 3, 2, 1, 0
+};
+
+/// Index of the quotients coprime to 30 inside the
+/// modulo 30 wheel: 1 -> 0, 7 -> 1, 11 -> 2, 13 -> 3,
+/// 17 -> 4, 19 -> 5, 23 -> 6, 29 -> 7.
+///
+const Array<uint8_t, 30> wheel_index =
+{
+  0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 3, 0,
+  0, 0, 4, 0, 5, 0, 0, 0, 6, 0, 0, 0, 0, 0, 7
+};
+
+/// Distance from a wheel quotient to the next one
+const Array<uint8_t, 8> wheel_steps = { 6, 4, 2, 4, 2, 4, 6, 2 };
+
+/// Inverse modulo 30 of the numbers coprime to 30
+const Array<uint8_t, 30> inverse30 =
+{
+  0, 1, 0, 0, 0, 0, 0, 13, 0, 0, 0, 11, 0, 7, 0,
+  0, 0, 23, 0, 19, 0, 0, 0, 17, 0, 0, 0, 0, 0, 29
+};
+
+/// Each thread owns one NthPrimeSieve object. The segments
+/// of a thread are [low + k * stride, high + k * stride]
+/// (or minus when sieving backwards). The sieving primes
+/// <= max_stored_prime are stored together with their
+/// position inside the modulo 30 wheel and carried over to
+/// the thread's next segment. Hence for these primes we
+/// neither need to regenerate them nor compute their first
+/// multiple using a (128-bit) division in each segment.
+///
 template <typename T>
 class NthPrimeSieve : public BitSieve240
 {
@@ -84,20 +129,54 @@ public:
     if (low % 240)
       low -= low % 240;
 
+    // low may be 64-bit and low_ 128-bit
+    using UT128 = typename pstd::make_unsigned<T>::type;
+    UT128 prev_low = (UT128) low_;
     low_ = low;
     UT dist = (high - low) + 1;
     uint64_t size = (uint64_t) ceil_div(dist, 240);
     uint64_t sqrt_high = (uint64_t) isqrt(high);
-    uint64_t prime;
+    uint64_t i_max = (uint64_t) (high - low);
 
     sieve_.resize(size);
     std::fill(sieve_.begin(), sieve_.end(), ~0ull);
     sieve_.front() &= unset_smaller_[old_low % 240];
     sieve_.back() &= unset_larger_[high % 240];
-    primesieve::iterator iter(7, sqrt_high);
 
     if (sqrt_high < low)
     {
+      // The stored sieving primes are only valid if the
+      // distance to the previous segment is the stride.
+      UT128 cur_low = (UT128) low;
+      UT128 delta = (cur_low > prev_low) ? cur_low - prev_low : prev_low - cur_low;
+      bool forward = cur_low > prev_low;
+
+      if (primes_.empty() || delta == 0 || delta > max_stride_)
+        init_primes(low, sqrt_high, size * 2);
+      else
+      {
+        if (stride_ == 0)
+          init_stride((uint64_t) delta);
+
+        if ((uint64_t) delta == stride_)
+          next_segment(forward);
+        else
+          init_primes(low, sqrt_high, size * 2);
+      }
+
+      for (auto& sp : primes_)
+      {
+        uint64_t i = sp.multiple;
+        uint64_t w = sp.wheel_index;
+        cross_off(sp.prime, i, w, i_max);
+      }
+
+      uint64_t start = max(max_stored_prime_ + 1, 7);
+      primesieve::iterator iter(start, sqrt_high);
+      uint64_t prime;
+
+      // Large sieving primes have few multiples inside the
+      // segment, for these the wheel does not pay off.
       while ((prime = iter.next_prime()) <= sqrt_high)
       {
         // Calculate first multiple > low
@@ -107,7 +186,6 @@ public:
         ASSERT(n > prime);
         ASSERT(n % 2 != 0);
         uint64_t i = (uint64_t) (n - low);
-        uint64_t i_max = (uint64_t) (high - low);
 
         // Cross-off multiples
         for (; i <= i_max; i += prime * 2)
@@ -116,21 +194,24 @@ public:
     }
     else
     {
+      primes_.clear();
+      primesieve::iterator iter(7, sqrt_high);
+      uint64_t prime;
+
       while ((prime = iter.next_prime()) <= sqrt_high)
       {
-        // Calculate first multiple > low
-        // that is not divisible by 2.
-        UT q = low / prime;
-        UT n = prime * (q + 1 + (q & 1));
-        n = max(n, UT(prime) * prime);
-        ASSERT(n > prime);
-        ASSERT(n % 2 != 0);
-        uint64_t i = (uint64_t) (n - low);
-        uint64_t i_max = (uint64_t) (high - low);
+        uint64_t i, w;
+        first_multiple(low, prime, i, w);
 
-        // Cross-off multiples
-        for (; i <= i_max; i += prime * 2)
-          sieve_[i / 240] &= unset_bit_[i % 240];
+        // Start crossing off at prime^2
+        UT square = UT(prime) * prime;
+        if (square > low + i)
+        {
+          i = (uint64_t) (square - low);
+          w = wheel_index[prime % 30];
+        }
+
+        cross_off(prime, i, w, i_max);
       }
     }
 
@@ -176,9 +257,125 @@ public:
   }
 
 private:
+  struct SievingPrime
+  {
+    uint64_t prime;
+    /// Offset of the first multiple inside the segment
+    uint64_t multiple;
+    /// stride % (prime * 30)
+    uint64_t stride_mod;
+    uint64_t wheel_index;
+  };
+
+  /// Find the first multiple of prime >= low (with low % 30 == 0)
+  /// whose quotient is coprime to 30. We only need low % prime,
+  /// the quotient modulo 30 is computed using the inverse of
+  /// prime modulo 30.
+  ///
+  template <typename UT>
+  static void first_multiple(UT low,
+                             uint64_t prime,
+                             uint64_t& i,
+                             uint64_t& w)
+  {
+    uint64_t r = (uint64_t) (low % prime);
+    i = (r == 0) ? 0 : prime - r;
+    uint64_t q = ((i % 30) * inverse30[prime % 30]) % 30;
+    i += next_coprime[q] * prime;
+    w = wheel_index[(q + next_coprime[q]) % 30];
+  }
+
+  /// Cross-off the multiples of prime whose
+  /// quotient is coprime to 30.
+  ///
+  void cross_off(uint64_t prime,
+                 uint64_t i,
+                 uint64_t w,
+                 uint64_t i_max)
+  {
+    for (; i <= i_max; w = (w + 1) & 7)
+    {
+      sieve_[i / 240] &= unset_bit_[i % 240];
+      i += prime * wheel_steps[w];
+    }
+  }
+
+  /// Store the sieving primes <= max_stored_prime together
+  /// with their first multiple inside the current segment.
+  /// With max_stored_prime = sieve size * 2 the memory usage
+  /// is below the memory usage of the sieve array.
+  ///
+  template <typename UT>
+  void init_primes(UT low,
+                   uint64_t sqrt_high,
+                   uint64_t max_stored_prime)
+  {
+    primes_.clear();
+    stride_ = 0;
+    max_stored_prime_ = min(sqrt_high, max_stored_prime);
+    primesieve::iterator iter(7, max_stored_prime_);
+    uint64_t prime;
+
+    while ((prime = iter.next_prime()) <= max_stored_prime_)
+    {
+      uint64_t i, w;
+      first_multiple(low, prime, i, w);
+      primes_.push_back(SievingPrime{prime, i, 0, w});
+    }
+
+    // The offsets of the next segment are
+    // stored in 64-bit integers.
+    max_stride_ = pstd::numeric_limits<uint64_t>::max() / 2;
+  }
+
+  void init_stride(uint64_t stride)
+  {
+    stride_ = stride;
+    for (auto& sp : primes_)
+      sp.stride_mod = stride % (sp.prime * 30);
+  }
+
+  /// Move the first multiples of the stored sieving primes
+  /// to the next segment. As the multiples repeat modulo
+  /// prime * 30 in the wheel we can skip the stride using
+  /// stride % (prime * 30) without any division. Afterwards
+  /// we walk back at most 7 wheel steps to find the first
+  /// multiple inside the next segment.
+  ///
+  void next_segment(bool forward)
+  {
+    for (auto& sp : primes_)
+    {
+      uint64_t cycle = sp.prime * 30;
+      uint64_t i = sp.multiple;
+      uint64_t w = sp.wheel_index;
+
+      if (forward)
+        i = (i >= sp.stride_mod) ? i - sp.stride_mod : i + cycle - sp.stride_mod;
+      else
+      {
+        i += sp.stride_mod;
+        i = (i >= cycle) ? i - cycle : i;
+      }
+
+      while (i >= sp.prime * wheel_steps[(w + 7) & 7])
+      {
+        w = (w + 7) & 7;
+        i -= sp.prime * wheel_steps[w];
+      }
+
+      sp.multiple = i;
+      sp.wheel_index = w;
+    }
+  }
+
   T low_ = 0;
   uint64_t count_ = 0;
   Vector<uint64_t> sieve_;
+  Vector<SievingPrime> primes_;
+  uint64_t max_stored_prime_ = 0;
+  uint64_t stride_ = 0;
+  uint64_t max_stride_ = 0;
 };
 
 /// The aligned_vector class aligns each of its
@@ -211,9 +408,40 @@ private:
   Vector<CacheLine> vect_;
 };
 
+/// Size of the segment that is sieved by
+/// each thread in nth_prime_sieve().
+///
+template <typename T>
+uint64_t nth_prime_sieve_thread_dist(T nth_prime_approx)
+{
+  T root3 = iroot<3>(nth_prime_approx);
+  uint64_t thread_dist = (uint64_t) (root3 * 30);
+  uint64_t min_thread_dist = 8 * 240;
+  thread_dist = max(min_thread_dist, thread_dist);
+
+  // The segments of each thread must be a constant
+  // stride apart, see NthPrimeSieve.
+  return ceil_div(thread_dist, 240) * 240;
+}
+
+/// Number of threads used by nth_prime_sieve() to find
+/// the nth prime starting from nth_prime_approx.
+///
+template <typename T>
+int nth_prime_sieve_threads(uint64_t n,
+                            T nth_prime_approx,
+                            int threads)
+{
+  uint64_t thread_dist = nth_prime_sieve_thread_dist(nth_prime_approx);
+  uint64_t avg_prime_gap = ilog(nth_prime_approx) + 2;
+  uint64_t dist_approx = n * avg_prime_gap;
+  return ideal_num_threads(dist_approx, threads, thread_dist);
+}
+
 /// Find the nth prime using a prime sieve.
 /// @sieve_forward = true:  Find nth prime >= nth_prime_approx.
 /// @sieve_forward = false: Find nth prime <= nth_prime_approx.
+/// @threads: Computed using nth_prime_sieve_threads().
 ///
 template <bool sieve_forward, typename T>
 T nth_prime_sieve(uint64_t n,
@@ -226,14 +454,13 @@ T nth_prime_sieve(uint64_t n,
   uint64_t count = 0;
   uint64_t while_iters = 0;
 
-  T root3 = iroot<3>(nth_prime_approx);
-  uint64_t thread_dist = (uint64_t) (root3 * 30);
-  uint64_t min_thread_dist = 8 * 240;
-  thread_dist = max(min_thread_dist, thread_dist);
+  uint64_t thread_dist = nth_prime_sieve_thread_dist(nth_prime_approx);
   uint64_t avg_prime_gap = ilog(nth_prime_approx) + 2;
   uint64_t dist_approx = n * avg_prime_gap;
 
-  threads = ideal_num_threads(dist_approx, threads, thread_dist);
+  ThreadLease lease(threads);
+
+  threads = lease.threads();
   aligned_vector<NthPrimeSieve<T>> sieves(threads);
   bool print_vars = is_print();
   bool finished = false;
@@ -23,6 +23,8 @@
 ///
 
 #include <primecount-internal.hpp>
+#include <ThreadLease.hpp>
+#include <cancel.hpp>
 #include <BitSieve240.hpp>
 #include <generate_primes.hpp>
 #include <fast_div.hpp>
@@ -385,6 +387,10 @@ int64_t phi_OpenMP(int64_t x, int64_t a, int threads)
   int max_threads = (int) std::sqrt(a);
   threads = min(threads, max_threads);
   threads = ideal_num_threads(x, threads, thread_threshold);
+  ThreadLease lease(threads);
+  threads = lease.threads();
+
+  const cancel_token* token = get_cancel_token();
 
   #pragma omp parallel num_threads(threads) reduction(+: sum)
   {
@@ -392,11 +398,16 @@ int64_t phi_OpenMP(int64_t x, int64_t a, int threads)
     // order to avoid thread synchronization.
     PhiCache cache(x, a, primes, pi);
 
+    // OpenMP does not allow breaking out of the loop,
+    // once cancelled we skip all remaining iterations.
     #pragma omp for nowait schedule(dynamic, 16)
     for (int64_t i = c + 1; i <= a; i++)
-      sum += cache.phi<-1>(x / primes[i], i - 1);
+      if (!is_cancelled(token))
+        sum += cache.phi<-1>(x / primes[i], i - 1);
   }
 
+  check_cancelled();
+
   return sum;
 }
 
@@ -12,8 +12,54 @@
 
 #include <primecount-internal.hpp>
 #include <primesieve.hpp>
+#include <primesieve/sieve_bits.hpp>
+#include <BitSieve240.hpp>
+#include <ThreadLease.hpp>
+#include <cancel.hpp>
+#include <imath.hpp>
+#include <int128_t.hpp>
+#include <min.hpp>
+#include <popcnt.hpp>
+#include <Vector.hpp>
 
 #include <stdint.h>
+#include <initializer_list>
+
+namespace {
+
+using namespace primecount;
+
+/// Counts the primes inside a chunk using the single
+/// threaded primesieve::sieve_bits(), hence the number of
+/// threads is controlled by the caller. The bits of the
+/// numbers outside of the chunk are removed using the
+/// BitSieve240 lookup tables.
+///
+class ChunkCounter : public BitSieve240
+{
+public:
+  /// Count the primes >= 7 inside [low, high]
+  int64_t count(uint64_t low, uint64_t high)
+  {
+    uint64_t low240 = low - low % 240;
+    uint64_t size = ceil_div((high - low240) + 1, 240);
+    bits_.resize(size);
+    primesieve::sieve_bits(low240, high + 1, bits_.data());
+    bits_.front() &= unset_smaller_[low % 240];
+    bits_.back() &= unset_larger_[high % 240];
+
+    int64_t count = 0;
+    for (uint64_t i = 0; i < size; i++)
+      count += popcnt64(bits_[i]);
+
+    return count;
+  }
+
+private:
+  Vector<uint64_t> bits_;
+};
+
+} // namespace
 
 namespace primecount {
 
@@ -25,4 +71,80 @@ int64_t pi_primesieve(int64_t x)
     return primesieve::count_primes(0, x);
 }
 
+/// Counting the primes inside ]x, x + dist] using the segmented
+/// sieve of Eratosthenes is faster than computing pi(x + dist)
+/// using Xavier Gourdon's algorithm if dist <= x^(2/3) / 2.
+/// On a modern x64 CPU primesieve counts the primes inside an
+/// interval of size 4 * 10^9 per second and thread, whereas
+/// computing pi(10^14) takes 0.5 seconds using a single thread.
+/// Returns 0 if x is too large for primesieve.
+///
+int64_t max_sieve_distance(maxint_t x)
+{
+  if (x < 2 || x >= pstd::numeric_limits<int64_t>::max())
+    return 0;
+
+  int64_t x13 = iroot<3>(x);
+  return (x13 * x13) / 2;
+}
+
+/// Count the primes inside [a, b] using the segmented sieve of
+/// Eratosthenes. Unlike primesieve::count_primes() this uses at
+/// most threads threads (leased from the library wide thread
+/// budget) and it stops once the computation has been
+/// cancelled. Used to count the primes inside the gaps of
+/// at most max_sieve_distance(x).
+///
+int64_t count_primes(int64_t a, int64_t b, int threads)
+{
+  a = max(a, 0);
+  if (b < a)
+    return 0;
+
+  // The primes 2, 3 and 5 are not part of
+  // the bit arrays of primesieve::sieve_bits().
+  int64_t sum = 0;
+  for (int64_t p : { 2, 3, 5 })
+    sum += (a <= p && p <= b);
+
+  a = max(a, 7);
+  if (b < a)
+    return sum;
+
+  // Each chunk needs the sieving primes <= sqrt(b), hence
+  // we use larger chunks for larger b. The chunk size is
+  // limited to 2^30 numbers i.e. 35 MB per thread.
+  int64_t min_chunk_size = 240 << 16;
+  int64_t max_chunk_size = 240 << 22;
+  int64_t chunk_size = in_between(min_chunk_size, isqrt(b), max_chunk_size);
+  chunk_size = ceil_div(chunk_size, 240) * 240;
+
+  int64_t low = a - a % 240;
+  int64_t chunks = ceil_div((b - low) + 1, chunk_size);
+  threads = ideal_num_threads((b - a) + 1, threads, chunk_size);
+  ThreadLease lease(threads);
+  threads = lease.threads();
+  const cancel_token* token = get_cancel_token();
+
+  #pragma omp parallel num_threads(threads) reduction(+: sum)
+  {
+    ChunkCounter counter;
+
+    #pragma omp for schedule(dynamic)
+    for (int64_t i = 0; i < chunks; i++)
+    {
+      if (is_cancelled(token))
+        continue;
+
+      int64_t start = max(low + i * chunk_size, a);
+      int64_t stop = min(low + (i + 1) * chunk_size - 1, b);
+      sum += counter.count(start, stop);
+    }
+  }
+
+  check_cancelled();
+
+  return sum;
+}
+
 } // namespace
@@ -0,0 +1,98 @@
+///
+/// @file  pi_range.cpp
+/// @brief Count the number of primes inside [a, b]. For short
+///        intervals the primes are counted using a segmented
+///        sieve of Eratosthenes (see count_primes()), for long intervals we
+///        compute pi(b) - pi(a - 1) using Xavier Gourdon's
+///        algorithm. In the latter case both pi(x) computations
+///        run concurrently, the threads are distributed according
+///        to the O(x^(2/3)) runtime of the two computations.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount-internal.hpp>
+#include <context.hpp>
+#include <int128_t.hpp>
+#include <print.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+#include <future>
+
+namespace {
+
+/// The runtime of pi(x) is O(x^(2/3))
+double cost(primecount::maxint_t x)
+{
+  return std::pow((double) x, 2.0 / 3.0);
+}
+
+} // namespace
+
+namespace primecount {
+
+maxint_t pi_range(maxint_t a,
+                  maxint_t b,
+                  int threads,
+                  bool is_print)
+{
+  a = std::max(a, (maxint_t) 2);
+  if (b < a)
+    return 0;
+
+  double time;
+
+  if (is_print)
+  {
+    print("");
+    print("=== pi_range(a, b) ===");
+    print("a", a);
+    print("b", b);
+    print("threads", threads);
+    time = get_time();
+  }
+
+  maxint_t res;
+
+  // Sieving is faster for short intervals
+  if (b <= pstd::numeric_limits<int64_t>::max() &&
+      b - a <= max_sieve_distance(b))
+    res = count_primes((int64_t) a, (int64_t) b, threads);
+  // The status of concurrent computations would
+  // be interleaved, pi(a - 1) is cheap for small a.
+  else if (threads < 2 ||
+           is_print ||
+           a - 1 <= (maxint_t) 1e8)
+    res = pi(b, threads) - pi(a - 1, threads);
+  else
+  {
+    double share = cost(a - 1) / (cost(a - 1) + cost(b));
+    int threads_a = (int) std::round(threads * share);
+    threads_a = in_between(1, threads_a, threads - 1);
+    int threads_b = threads - threads_a;
+
+    // The new thread must use the same context,
+    // cancellation token and progress callback.
+    ThreadScope scope = get_thread_scope();
+
+    auto pia = std::async(std::launch::async, [a, threads_a, scope] {
+      InheritScope inheritScope(scope);
+      return pi(a - 1, threads_a);
+    });
+
+    maxint_t pib = pi(b, threads_b);
+    res = pib - pia.get();
+  }
+
+  if (is_print)
+    print("pi_range(a, b)", res, time);
+
+  return res;
+}
+
+} // namespace
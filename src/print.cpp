@@ -8,6 +8,7 @@
 ///
 
 #include <print.hpp>
+#include <context.hpp>
 #include <primecount-internal.hpp>
 #include <int128_t.hpp>
 #include <stdint.h>
@@ -27,7 +28,7 @@ bool is_print_variables()
 
 void print_threads(int threads)
 {
-  std::cout << "threads = " << threads << std::endl;
+  primecount::get_print_stream() << "threads = " << threads << std::endl;
 }
 
 } // naespace
@@ -36,7 +37,12 @@ namespace primecount {
 
 bool is_print()
 {
-  return print_;
+  const context* ctx = get_context();
+
+  if (ctx)
+    return ctx->print;
+  else
+    return print_;
 }
 
 /// The final combined result is always shown at
@@ -60,17 +66,17 @@ void set_print_variables(bool print_variables)
 
 void print_seconds(double seconds)
 {
-  std::cout << "Seconds: " << std::fixed << std::setprecision(3) << seconds << std::endl;
+  get_print_stream() << "Seconds: " << std::fixed << std::setprecision(3) << seconds << std::endl;
 }
 
 void print(string_view_t str)
 {
-  std::cout << str << std::endl;
+  get_print_stream() << str << std::endl;
 }
 
 void print(string_view_t str, maxint_t res)
 {
-  std::cout << str << " = " << res << std::endl;
+  get_print_stream() << str << " = " << res << std::endl;
 }
 
 void print(string_view_t str, maxint_t res, double time)
@@ -79,19 +85,19 @@ void print(string_view_t str, maxint_t res, double time)
   // which could be e.g.:
   // "Status: 99.9999999991%"
   // "Segments; 123456789/123456789"
-  std::cout << "\rStatus: 100%                                 " << std::endl;
-  std::cout << str << " = " << res << std::endl;
+  get_print_stream() << "\rStatus: 100%                                 " << std::endl;
+  get_print_stream() << str << " = " << res << std::endl;
   print_seconds(get_time() - time);
 }
 
 /// Used by pi_lmo(x), pi_deleglise_rivat(x)
 void print(maxint_t x, int64_t y, int64_t z, int64_t c, int threads)
 {
-  std::cout << "x = " << x << std::endl;
-  std::cout << "y = " << y << std::endl;
-  std::cout << "z = " << z << std::endl;
-  std::cout << "c = " << c << std::endl;
-  std::cout << "alpha = " << std::fixed << std::setprecision(3) << get_alpha(x, y) << std::endl;
+  get_print_stream() << "x = " << x << std::endl;
+  get_print_stream() << "y = " << y << std::endl;
+  get_print_stream() << "z = " << z << std::endl;
+  get_print_stream() << "c = " << c << std::endl;
+  get_print_stream() << "alpha = " << std::fixed << std::setprecision(3) << get_alpha(x, y) << std::endl;
   print_threads(threads);
 }
 
@@ -101,12 +107,12 @@ void print_vars(maxint_t x, int64_t y, int threads)
   if (is_print_variables())
   {
     maxint_t z = x / y;
-    std::cout << "x = " << x << std::endl;
-    std::cout << "y = " << y << std::endl;
-    std::cout << "z = " << z << std::endl;
-    std::cout << "alpha = " << std::fixed << std::setprecision(3) << get_alpha(x, y) << std::endl;
+    get_print_stream() << "x = " << x << std::endl;
+    get_print_stream() << "y = " << y << std::endl;
+    get_print_stream() << "z = " << z << std::endl;
+    get_print_stream() << "alpha = " << std::fixed << std::setprecision(3) << get_alpha(x, y) << std::endl;
     print_threads(threads);
-    std::cout << std::endl;
+    get_print_stream() << std::endl;
   }
 }
 
@@ -117,20 +123,20 @@ void print_vars(maxint_t x, int64_t y, int64_t c, int threads)
   {
     int64_t z = (int64_t)(x / y);
     print(x, y, z, c, threads);
-    std::cout << std::endl;
+    get_print_stream() << std::endl;
   }
 }
 
 /// Used by pi_gourdon(x)
 void print_gourdon(maxint_t x, int64_t y, int64_t z, int64_t k, int threads)
 {
-  std::cout << "x = " << x << std::endl;
-  std::cout << "y = " << y << std::endl;
-  std::cout << "z = " << z << std::endl;
-  std::cout << "k = " << k << std::endl;
-  std::cout << "x_star = " << get_x_star_gourdon(x, y) << std::endl;
-  std::cout << "alpha_y = " << std::fixed << std::setprecision(3) << get_alpha_y(x, y) << std::endl;
-  std::cout << "alpha_z = " << std::fixed << std::setprecision(3) << get_alpha_z(y, z) << std::endl;
+  get_print_stream() << "x = " << x << std::endl;
+  get_print_stream() << "y = " << y << std::endl;
+  get_print_stream() << "z = " << z << std::endl;
+  get_print_stream() << "k = " << k << std::endl;
+  get_print_stream() << "x_star = " << get_x_star_gourdon(x, y) << std::endl;
+  get_print_stream() << "alpha_y = " << std::fixed << std::setprecision(3) << get_alpha_y(x, y) << std::endl;
+  get_print_stream() << "alpha_z = " << std::fixed << std::setprecision(3) << get_alpha_z(y, z) << std::endl;
   print_threads(threads);
 }
 
@@ -139,11 +145,11 @@ void print_gourdon_vars(maxint_t x, int64_t y, int threads)
 {
   if (is_print_variables())
   {
-    std::cout << "x = " << x << std::endl;
-    std::cout << "y = " << y << std::endl;
-    std::cout << "alpha_y = " << std::fixed << std::setprecision(3) << get_alpha_y(x, y) << std::endl;
+    get_print_stream() << "x = " << x << std::endl;
+    get_print_stream() << "y = " << y << std::endl;
+    get_print_stream() << "alpha_y = " << std::fixed << std::setprecision(3) << get_alpha_y(x, y) << std::endl;
     print_threads(threads);
-    std::cout << std::endl;
+    get_print_stream() << std::endl;
   }
 }
 
@@ -153,7 +159,7 @@ void print_gourdon_vars(maxint_t x, int64_t y, int64_t z, int64_t k, int threads
   if (is_print_variables())
   {
     print_gourdon(x, y, z, k, threads);
-    std::cout << std::endl;
+    get_print_stream() << std::endl;
   }
 }
 
@@ -164,12 +170,12 @@ void print_nth_prime_sieve(uint64_t n,
                            uint64_t thread_dist,
                            int threads)
 {
-  std::cout << "n = " << n << std::endl;
-  std::cout << "sieve_forward = " << (sieve_forward ? "true" : "false") << std::endl;
-  std::cout << "nth_prime_approx = " << nth_prime_approx << std::endl;
-  std::cout << "dist_approx = " << dist_approx << std::endl;
-  std::cout << "thread_dist = " << thread_dist << std::endl;
-  std::cout << "threads = " << threads << std::endl;
+  get_print_stream() << "n = " << n << std::endl;
+  get_print_stream() << "sieve_forward = " << (sieve_forward ? "true" : "false") << std::endl;
+  get_print_stream() << "nth_prime_approx = " << nth_prime_approx << std::endl;
+  get_print_stream() << "dist_approx = " << dist_approx << std::endl;
+  get_print_stream() << "thread_dist = " << thread_dist << std::endl;
+  get_print_stream() << "threads = " << threads << std::endl;
 }
 
 } // namespace
@@ -0,0 +1,153 @@
+///
+/// @file  tuning.cpp
+/// @brief Load and store the per machine tuning factors that
+///        are generated by primecount --calibrate. The tuning
+///        file is a plain text file with one "name = value"
+///        pair per line, lines starting with '#' are comments.
+///        By default the tuning file is located at
+///        $HOME/.primecount-tuning.txt, the PRIMECOUNT_TUNING_FILE
+///        environment variable can be used to specify another
+///        location (or an empty string to disable the tuning file).
+///        libprimecount never reads the tuning file implicitly,
+///        the primecount binary opts in using load_tuning_file().
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <tuning.hpp>
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+namespace {
+
+using namespace primecount;
+
+Tuning tuning_;
+std::mutex tuning_mutex_;
+
+std::string trim(const std::string& str)
+{
+  const char* whitespace = " \t\r\n";
+  std::size_t first = str.find_first_not_of(whitespace);
+  if (first == std::string::npos)
+    return std::string();
+  std::size_t last = str.find_last_not_of(whitespace);
+  return str.substr(first, last - first + 1);
+}
+
+} // namespace
+
+namespace primecount {
+
+/// Invalid lines and out of range values are silently
+/// ignored, a broken tuning file must not prevent
+/// primecount from computing pi(x).
+///
+void load_tuning_file()
+{
+  std::string filename = get_tuning_file();
+  if (filename.empty())
+    return;
+
+  std::ifstream file(filename);
+  if (!file)
+    return;
+
+  Tuning tuning;
+  std::string line;
+
+  while (std::getline(file, line))
+  {
+    line = trim(line);
+    std::size_t pos = line.find('=');
+    if (line.empty() || line[0] == '#' || pos == std::string::npos)
+      continue;
+
+    std::string name = trim(line.substr(0, pos));
+    std::istringstream iss(trim(line.substr(pos + 1)));
+    double value;
+    if (!(iss >> value))
+      continue;
+
+    if (name == "alpha_yz_factor" && value >= 0.1 && value <= 10)
+      tuning.alpha_yz_factor = value;
+    else if (name == "alpha_z" && value >= 1 && value <= 100)
+      tuning.alpha_z = value;
+    else if (name == "D_threads_exponent" && value >= 2 && value <= 8)
+      tuning.D_threads_exponent = value;
+    else if (name == "AC_threads_exponent" && value >= 2 && value <= 8)
+      tuning.AC_threads_exponent = value;
+  }
+
+  set_tuning(tuning);
+}
+
+/// Returns a copy as the tuning factors
+/// may be changed concurrently.
+///
+Tuning get_tuning()
+{
+  std::lock_guard<std::mutex> lock(tuning_mutex_);
+  return tuning_;
+}
+
+/// Used by primecount --calibrate to
+/// benchmark different tuning factors.
+///
+void set_tuning(const Tuning& tuning)
+{
+  std::lock_guard<std::mutex> lock(tuning_mutex_);
+  tuning_ = tuning;
+}
+
+std::string get_tuning_file()
+{
+  const char* filename = std::getenv("PRIMECOUNT_TUNING_FILE");
+  if (filename)
+    return filename;
+
+#if defined(_WIN32)
+  const char* home = std::getenv("USERPROFILE");
+#else
+  const char* home = std::getenv("HOME");
+#endif
+
+  if (!home || !*home)
+    return std::string();
+
+  return std::string(home) + "/.primecount-tuning.txt";
+}
+
+void write_tuning_file(const Tuning& tuning,
+                       const std::string& filename,
+                       const std::string& comment)
+{
+  if (filename.empty())
+    throw primecount_error("no tuning file location, set PRIMECOUNT_TUNING_FILE");
+
+  std::ofstream file(filename);
+  if (!file)
+    throw primecount_error("failed to create tuning file: " + filename);
+
+  file << "# primecount tuning file generated by: primecount --calibrate\n"
+       << "# Delete this file to restore the default tuning factors.\n"
+       << comment
+       << "alpha_yz_factor = " << tuning.alpha_yz_factor << "\n"
+       << "alpha_z = " << tuning.alpha_z << "\n"
+       << "D_threads_exponent = " << tuning.D_threads_exponent << "\n"
+       << "AC_threads_exponent = " << tuning.AC_threads_exponent << "\n";
+
+  if (!file)
+    throw primecount_error("failed to write tuning file: " + filename);
+}
+
+} // namespace
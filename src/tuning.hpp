@@ -0,0 +1,48 @@
+///
+/// @file  tuning.hpp
+/// @brief Per machine tuning factors that are generated by
+///        primecount --calibrate and stored in a tuning file.
+///        The tuning file is only loaded if load_tuning_file()
+///        is called (by the primecount binary), otherwise the
+///        default tuning factors are used.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef TUNING_HPP
+#define TUNING_HPP
+
+#include <string>
+
+namespace primecount {
+
+struct Tuning
+{
+  /// Correction factor for the alpha_y * alpha_z
+  /// polynomial in get_alpha_gourdon().
+  double alpha_yz_factor = 1.0;
+
+  /// Default alpha_z tuning factor, if < 1 then
+  /// primecount's default alpha_z is used.
+  double alpha_z = -1;
+
+  /// max_threads = (x / z)^(1 / exponent), used to limit
+  /// the number of threads for small computations.
+  double D_threads_exponent = 3.7;
+  double AC_threads_exponent = 3.7;
+};
+
+Tuning get_tuning();
+void load_tuning_file();
+void set_tuning(const Tuning& tuning);
+std::string get_tuning_file();
+void write_tuning_file(const Tuning& tuning,
+                       const std::string& filename,
+                       const std::string& comment);
+
+} // namespace
+
+#endif
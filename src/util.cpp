@@ -12,10 +12,12 @@
 #include <primecount.hpp>
 #include <primecount-internal.hpp>
 #include <calculator.hpp>
+#include <context.hpp>
 #include <int128_t.hpp>
 #include <imath.hpp>
 #include <macros.hpp>
 #include <min.hpp>
+#include <tuning.hpp>
 
 #include <algorithm>
 #include <chrono>
@@ -60,6 +62,19 @@ double truncate3(double n)
   return (int64_t)(n * 1000) / 1000.0;
 }
 
+/// The alpha tuning factors of the context of the current
+/// thread take precedence over the global settings.
+///
+double get_alpha_setting(double alpha, double primecount::context::* member)
+{
+  const primecount::context* ctx = primecount::get_context();
+
+  if (ctx && ctx->*member >= 1.0)
+    return truncate3(ctx->*member);
+  else
+    return alpha;
+}
+
 } // namespace
 
 namespace primecount {
@@ -263,7 +278,7 @@ double get_alpha_z(int64_t y, int64_t z)
 ///
 double get_alpha_lmo(maxint_t x)
 {
-  double alpha = alpha_;
+  double alpha = get_alpha_setting(alpha_, &context::alpha);
   double x16 = (double) iroot<6>(x);
 
   // use default alpha if no command-line alpha provided
@@ -296,7 +311,7 @@ double get_alpha_lmo(maxint_t x)
 ///
 double get_alpha_deleglise_rivat(maxint_t x)
 {
-  double alpha = alpha_;
+  double alpha = get_alpha_setting(alpha_, &context::alpha);
   double x16 = (double) iroot<6>(x);
 
   // Use default alpha
@@ -348,10 +363,15 @@ double get_alpha_deleglise_rivat(maxint_t x)
 /// z = y * alpha_z, with alpha_z >= 1.
 /// alpha_y * alpha_z <= x^(1/6)
 ///
+/// The default alpha_yz polynomial and alpha_z have been
+/// determined on the author's computers, primecount --calibrate
+/// stores corrections for the user's CPU in a tuning file.
+///
 std::pair<double, double> get_alpha_gourdon(maxint_t x)
 {
-  double alpha_y = alpha_y_;
-  double alpha_z = alpha_z_;
+  Tuning tuning = get_tuning();
+  double alpha_y = get_alpha_setting(alpha_y_, &context::alpha_y);
+  double alpha_z = get_alpha_setting(alpha_z_, &context::alpha_z);
   double x16 = (double) iroot<6>(x);
   double logx = std::log((double) x);
   double alpha_yz;
@@ -374,6 +394,7 @@ std::pair<double, double> get_alpha_gourdon(maxint_t x)
     double logx2 = logx * logx;
     double logx3 = logx * logx * logx;
     alpha_yz = a * logx3 + b * logx2 + c * logx + d;
+    alpha_yz *= tuning.alpha_yz_factor;
   }
 
   // Use default alpha_z
@@ -403,6 +424,10 @@ std::pair<double, double> get_alpha_gourdon(maxint_t x)
     // an alpha_z > 1 will likely improve performance.
     alpha_z = 2;
 
+    // Use calibrated alpha_z from tuning file
+    if (tuning.alpha_z >= 1)
+      alpha_z = tuning.alpha_z;
+
     // alpha_z should be significantly smaller than alpha_y
     alpha_z = in_between(1, alpha_yz / 5, alpha_z);
   }
@@ -431,6 +456,23 @@ std::pair<double, double> get_alpha_gourdon(maxint_t x)
   return std::make_pair(alpha_y, alpha_z);
 }
 
+/// Maximum number of threads for the D formula.
+/// Using too many threads for small computations
+/// deteriorates performance.
+///
+int get_max_threads_D(int64_t xz)
+{
+  double exponent = get_tuning().D_threads_exponent;
+  return (int) std::pow(xz, 1 / exponent);
+}
+
+/// Maximum number of threads for the A + C formulas
+int get_max_threads_AC(int64_t xz)
+{
+  double exponent = get_tuning().AC_threads_exponent;
+  return (int) std::pow(xz, 1 / exponent);
+}
+
 /// x_star = max(x^(1/4), x / y^2)
 ///
 /// After my implementation of Xavier Gourdon's algorithm worked for
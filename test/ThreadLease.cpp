@@ -0,0 +1,139 @@
+///
+/// @file   ThreadLease.cpp
+/// @brief  Test the library wide thread budget that is shared
+///         by concurrent pi(x) computations.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <ThreadLease.hpp>
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstdlib>
+#include <future>
+#include <thread>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+int main()
+{
+  int max_threads = ThreadLease::available_threads();
+  std::cout << "available_threads() = " << max_threads;
+  check(max_threads >= 1);
+
+  {
+    ThreadLease lease(max_threads + 10);
+    std::cout << "lease(" << max_threads + 10 << ").threads() = " << lease.threads();
+    check(lease.threads() == max_threads);
+    std::cout << "available_threads() = " << ThreadLease::available_threads();
+    check(ThreadLease::available_threads() == 0);
+
+    // Nested leases are limited to the threads
+    // of the enclosing lease.
+    {
+      ThreadLease nested(max_threads + 10);
+      std::cout << "nested.threads() = " << nested.threads();
+      check(nested.threads() == max_threads);
+      std::cout << "available_threads() = " << ThreadLease::available_threads();
+      check(ThreadLease::available_threads() == 0);
+    }
+
+    // All threads are in use, other threads
+    // get a single thread.
+    int threads = 0;
+    int64_t res = 0;
+    std::thread t([&]
+    {
+      ThreadLease other(8);
+      threads = other.threads();
+      res = pi((int64_t) 1e12);
+    });
+    t.join();
+
+    std::cout << "other.threads() = " << threads;
+    check(threads == 1);
+    std::cout << "pi(1e12) = " << res;
+    check(res == 37607912018ll);
+  }
+
+  std::cout << "available_threads() = " << ThreadLease::available_threads();
+  check(ThreadLease::available_threads() == max_threads);
+
+  int64_t res = pi((int64_t) 1e12);
+  std::cout << "pi(1e12) = " << res;
+  check(res == 37607912018ll);
+  std::cout << "available_threads() = " << ThreadLease::available_threads();
+  check(ThreadLease::available_threads() == max_threads);
+
+#ifdef _OPENMP
+  // The budget is get_num_threads(), it is
+  // shared with the pi_async() jobs.
+  omp_set_num_threads(4);
+  set_num_threads(4);
+  std::cout << "max_threads() = " << ThreadLease::max_threads();
+  check(ThreadLease::max_threads() == 4);
+  std::cout << "available_threads() = " << ThreadLease::available_threads();
+  check(ThreadLease::available_threads() == 4);
+
+  {
+    ThreadLease lease(4);
+    std::promise<void> leased;
+    std::promise<void> done;
+
+    // Oversubscribe the budget by 1 thread
+    std::thread t([&]
+    {
+      ThreadLease other(4);
+      leased.set_value();
+      done.get_future().wait();
+    });
+
+    leased.get_future().wait();
+    std::cout << "available_threads() = " << ThreadLease::available_threads();
+    check(ThreadLease::available_threads() == 0);
+
+    // At a work unit boundary a single thread
+    // is returned to the budget.
+    int released = 0;
+    #pragma omp parallel num_threads(4) reduction(+: released)
+    {
+      for (int i = 0; i < 10; i++)
+        released += lease.release_thread();
+    }
+
+    std::cout << "released threads = " << released;
+    check(released == 1);
+
+    done.set_value();
+    t.join();
+
+    std::cout << "available_threads() = " << ThreadLease::available_threads();
+    check(ThreadLease::available_threads() == 1);
+  }
+
+  std::cout << "available_threads() = " << ThreadLease::available_threads();
+  check(ThreadLease::available_threads() == 4);
+#endif
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
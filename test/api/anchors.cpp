@@ -0,0 +1,135 @@
+///
+/// @file   anchors.cpp
+/// @brief  Test computing pi(x) using known values of pi(x)
+///         (anchors) nearby.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount.h>
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+int main()
+{
+  // Compute the expected results without anchors
+  int64_t x1 = (int64_t) 1e12 + 123456789;
+  int64_t x2 = (1ll << 40) - 987654321;
+  int64_t x3 = (int64_t) 3e12;
+  int64_t x4 = (int64_t) 5e12;
+  int64_t pix1 = pi(x1);
+  int64_t pix2 = pi(x2);
+  int64_t pix3 = pi(x3);
+  int64_t pix4 = pi(x4);
+
+  set_anchors(true);
+
+  // Near pi(10^12)
+  int64_t res = pi(x1);
+  std::cout << "pi(" << x1 << ") = " << res;
+  check(res == pix1);
+
+  // Near pi(2^40)
+  res = pi(x2);
+  std::cout << "pi(" << x2 << ") = " << res;
+  check(res == pix2);
+
+  // pi(10^18) would take minutes without anchors
+  res = pi((int64_t) 1e18);
+  std::cout << "pi(10^18) = " << res;
+  check(res == 24739954287740860ll);
+
+  int64_t x = (int64_t) 1e18 - 1000000;
+  res = pi(x);
+  std::cout << "pi(" << x << ") = " << res;
+  check(res == 24739954287740860ll - (int64_t) primesieve::count_primes(x + 1, (uint64_t) 1e18));
+
+  x = (1ll << 62) + 1000000;
+  res = pi(x);
+  std::cout << "pi(" << x << ") = " << res;
+  check(res == pi(int64_t(1ll << 62)) + (int64_t) primesieve::count_primes(1ull << 62, x));
+
+  // User anchors
+  std::string filename = "primecount-anchors-test.txt";
+  {
+    std::ofstream file(filename);
+    file << "# x pi(x)" << std::endl;
+    file << "3e12 " << pix3 << std::endl;
+  }
+
+  load_anchors(filename);
+  std::remove(filename.c_str());
+  x = x3 - 5000000;
+  res = pi(x);
+  std::cout << "pi(" << x << ") = " << res;
+  check(res == pix3 - (int64_t) primesieve::count_primes(x + 1, x3));
+
+  add_anchor(x4, pix4);
+  x = x4 + 10000000;
+  res = pi(x);
+  std::cout << "pi(" << x << ") = " << res;
+  check(res == pix4 + (int64_t) primesieve::count_primes(x4 + 1, x));
+
+  try
+  {
+    add_anchor(100, 101);
+    std::cout << "add_anchor(100, 101)";
+    check(false);
+  }
+  catch (const primecount_error& e)
+  {
+    std::cout << "add_anchor(100, 101): " << e.what();
+    check(true);
+  }
+
+  try
+  {
+    load_anchors("primecount-anchors-does-not-exist.txt");
+    std::cout << "load_anchors(does not exist)";
+    check(false);
+  }
+  catch (const primecount_error& e)
+  {
+    std::cout << "load_anchors(does not exist): " << e.what();
+    check(true);
+  }
+
+  // Test the C API
+  int64_t y = (int64_t) 2e12;
+  int64_t piy = primecount_pi(y);
+  std::cout << "primecount_add_anchor(2e12)";
+  check(primecount_add_anchor(y, piy) == 0);
+  std::cout << "primecount_add_anchor(-1)";
+  check(primecount_add_anchor(-1, 0) == -1);
+  std::cout << "primecount_load_anchors(NULL)";
+  check(primecount_load_anchors(NULL) == -1);
+
+  set_anchors(false);
+  res = primecount_pi(x1);
+  std::cout << "primecount_pi(" << x1 << ") = " << res;
+  check(res == pix1);
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,200 @@
+///
+/// @file   async.cpp
+/// @brief  Test pi_async() and nth_prime_async() of primecount's
+///         C++ and C APIs.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount.h>
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+std::atomic<int> c_status(1);
+char c_result[32];
+
+void c_completion(const char* result, int status, void* data)
+{
+  if (result && data == (void*) c_result)
+    std::strncpy(c_result, result, sizeof(c_result) - 1);
+  c_status = status;
+}
+
+int main()
+{
+  // Multiple concurrent computations
+  {
+    const char* pix[] = { "4118054813", "37607912018", "346065536839", "3204941750802" };
+    async_result results[4];
+
+    for (int i = 0; i < 4; i++)
+      results[i] = pi_async("1e" + std::to_string(11 + i));
+
+    for (int i = 0; i < 4; i++)
+    {
+      std::string res = results[i].get();
+      std::cout << "pi_async(1e" << 11 + i << ") = " << res;
+      check(res == pix[i]);
+    }
+  }
+
+  {
+    async_result result = nth_prime_async(1000000000);
+    std::string res = result.get();
+    std::cout << "nth_prime_async(1e9) = " << res;
+    check(res == "22801763489");
+    std::cout << "is_ready() = " << result.is_ready();
+    check(result.is_ready());
+  }
+
+  // Per computation progress callback and completion callback.
+  // We use a single thread to ensure that the computation
+  // runs long enough for at least one progress report.
+  {
+    std::atomic<int> calls(0);
+    std::atomic<bool> completed(false);
+    async_options options;
+    options.threads = 1;
+    options.progress = [&](const primecount::pc_progress_t&) { calls++; };
+    options.completion = [&](const async_result& r) { completed = r.is_ready(); };
+
+    async_result result = pi_async((int64_t) 1e15, options);
+    std::string res = result.get();
+    std::cout << "pi_async(1e15) = " << res;
+    check(res == "29844570422669");
+    std::cout << "progress calls = " << calls;
+    check(calls > 0);
+    std::cout << "progress().formula = " << result.progress().formula;
+    check(result.progress().formula != nullptr);
+
+    while (!completed)
+      result.wait_for(0.01);
+    std::cout << "completion callback called";
+    check(completed);
+  }
+
+  // Cancel a computation
+  {
+    async_result result = pi_async("1e18");
+    result.cancel();
+    bool cancelled = false;
+
+    try {
+      result.get();
+    }
+    catch (const primecount_cancelled&) {
+      cancelled = true;
+    }
+
+    std::cout << "pi_async(1e18).cancel() throws primecount_cancelled";
+    check(cancelled);
+  }
+
+  // Timeout
+  {
+    async_options options;
+    options.timeout = 0.2;
+    async_result result = pi_async("1e18", options);
+    std::cout << "pi_async(1e18, timeout 0.2s).wait_for(60)";
+    check(result.wait_for(60));
+    bool cancelled = false;
+
+    try {
+      result.get();
+    }
+    catch (const primecount_cancelled&) {
+      cancelled = true;
+    }
+
+    std::cout << "pi_async(1e18, timeout 0.2s) throws primecount_cancelled";
+    check(cancelled);
+  }
+
+  // Errors are rethrown by get()
+  {
+    async_result result = nth_prime_async(0);
+    bool error = false;
+
+    try {
+      result.get();
+    }
+    catch (const primecount_error&) {
+      error = true;
+    }
+
+    std::cout << "nth_prime_async(0) throws primecount_error";
+    check(error);
+  }
+
+  // The timeout does not include the time spent
+  // waiting in the queue for a free thread.
+  {
+    int threads = get_num_threads();
+    set_num_threads(1);
+    async_result result1 = pi_async("1e18");
+    async_options options;
+    options.timeout = 0.3;
+    async_result result2 = pi_async("1e10", options);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    result1.cancel();
+    std::string res = result2.get();
+    std::cout << "pi_async(1e10, timeout 0.3s) after 0.5s in queue = " << res;
+    check(res == "455052511");
+    set_num_threads(threads);
+  }
+
+  // Test the C API
+  {
+    primecount_async_options options;
+    std::memset(&options, 0, sizeof(options));
+    options.completion = c_completion;
+    options.data = (void*) c_result;
+
+    primecount_async* handle = primecount_pi_async("10000000000000", &options);
+    char out[32];
+    int len = primecount_async_get(handle, out, sizeof(out));
+    std::cout << "primecount_async_get(primecount_pi_async(1e13)) = " << out;
+    check(len > 0 && std::strcmp(out, "346065536839") == 0);
+    primecount_async_destroy(handle);
+
+    while (c_status == 1) {}
+    std::cout << "completion callback result = " << c_result;
+    check(c_status == 0 && std::strcmp(c_result, "346065536839") == 0);
+
+    handle = primecount_nth_prime_async("1000000000000000000", NULL);
+    primecount_async_cancel(handle);
+    len = primecount_async_get(handle, out, sizeof(out));
+    std::cout << "primecount_async_get(cancelled) = " << len;
+    check(len == -2);
+    primecount_async_destroy(handle);
+  }
+
+  // At exit the running computation is
+  // cancelled and its worker thread joined.
+  pi_async("1e18");
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
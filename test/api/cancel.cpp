@@ -0,0 +1,140 @@
+///
+/// @file   cancel.cpp
+/// @brief  Test cancelling pi(x) computations using a
+///         cancel_token (C++ and C APIs).
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount.h>
+#include <primecount-internal.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+int main()
+{
+  // Token that has not been cancelled
+  {
+    cancel_token token;
+    int64_t x = (int64_t) 1e13;
+    int64_t res = pi(x, token);
+    std::cout << "pi(" << x << ", token) = " << res;
+    check(res == 346065536839ll);
+
+    std::string str = pi("100000000000000", token);
+    std::cout << "pi(\"100000000000000\", token) = " << str;
+    check(str == "3204941750802");
+
+    int64_t n = 1000000000;
+    res = nth_prime(n, token);
+    std::cout << "nth_prime(" << n << ", token) = " << res;
+    check(res == 22801763489ll);
+  }
+
+  // Token that has been cancelled before the computation
+  {
+    cancel_token token;
+    token.cancel();
+    bool cancelled = false;
+
+    try {
+      pi((int64_t) 1e15, token);
+    }
+    catch (const primecount_cancelled&) {
+      cancelled = true;
+    }
+
+    std::cout << "pi(1e15, cancelled token) throws primecount_cancelled";
+    check(cancelled);
+  }
+
+  // Cancel the computation using a timeout, the computation
+  // of pi(10^17) takes much longer than the timeout.
+  {
+    cancel_token token;
+    token.set_timeout(0.2);
+    bool cancelled = false;
+    double time = get_time();
+
+    try {
+      pi("100000000000000000", token);
+    }
+    catch (const primecount_cancelled&) {
+      cancelled = true;
+    }
+
+    double seconds = get_time() - time;
+    std::cout << "pi(1e17, timeout 0.2s) throws primecount_cancelled";
+    check(cancelled);
+    std::cout << "pi(1e17, timeout 0.2s) seconds = " << seconds;
+    check(seconds < 10);
+  }
+
+  // A primecount_cancelled is a primecount_error
+  {
+    cancel_token token;
+    token.cancel();
+    bool error = false;
+
+    try {
+      nth_prime(1000000000, token);
+    }
+    catch (const primecount_error&) {
+      error = true;
+    }
+
+    std::cout << "nth_prime(1e9, cancelled token) throws primecount_error";
+    check(error);
+  }
+
+  // Computations without token must not be affected
+  // by the previously cancelled computations.
+  {
+    int64_t x = (int64_t) 1e13;
+    int64_t res = pi(x);
+    std::cout << "pi(" << x << ") = " << res;
+    check(res == 346065536839ll);
+  }
+
+  // Test the C API
+  {
+    primecount_cancel_token* token = primecount_cancel_token_create();
+    int64_t x = (int64_t) 1e13;
+    int64_t res = primecount_pi_cancellable(x, token);
+    std::cout << "primecount_pi_cancellable(" << x << ") = " << res;
+    check(res == 346065536839ll);
+
+    primecount_cancel_after(token, 0.2);
+    char out[32];
+    int len = primecount_pi_str_cancellable("100000000000000000", out, sizeof(out), token);
+    std::cout << "primecount_pi_str_cancellable(1e17, timeout 0.2s) = " << len;
+    check(len == -2);
+
+    primecount_cancel(token);
+    res = primecount_pi_cancellable(x, token);
+    std::cout << "primecount_pi_cancellable(" << x << ", cancelled token) = " << res;
+    check(res == -2);
+    primecount_cancel_token_destroy(token);
+  }
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,211 @@
+///
+/// @file   context.cpp
+/// @brief  Test the per computation settings (context)
+///         of primecount's C++ and C APIs.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount.h>
+
+#include <stdint.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+bool contains(const std::string& str, const std::string& substr)
+{
+  return str.find(substr) != std::string::npos;
+}
+
+int main()
+{
+  {
+    context ctx;
+    ctx.threads = 1;
+    int64_t x = (int64_t) 1e12;
+    int64_t res = pi(x, ctx);
+    std::cout << "pi(" << x << ", ctx) = " << res;
+    check(res == 37607912018ll);
+
+    std::string str = pi("1e12", ctx);
+    std::cout << "pi(1e12, ctx) = " << str;
+    check(str == "37607912018");
+
+    res = nth_prime((int64_t) 1e9, ctx);
+    std::cout << "nth_prime(1e9, ctx) = " << res;
+    check(res == 22801763489ll);
+  }
+
+  // Run 2 computations with different settings
+  // at the same time, each prints to its own stream.
+  {
+    std::ostringstream out1;
+    std::ostringstream out2;
+    context ctx1;
+    context ctx2;
+    ctx1.threads = 1;
+    ctx1.alpha_y = 2;
+    ctx1.alpha_z = 1.5;
+    ctx1.print = true;
+    ctx1.print_stream = &out1;
+    ctx2.threads = 1;
+    ctx2.alpha_y = 3;
+    ctx2.alpha_z = 1.25;
+    ctx2.print = true;
+    ctx2.print_stream = &out2;
+
+    int64_t res1 = 0;
+    int64_t res2 = 0;
+    std::thread t1([&] { res1 = pi((int64_t) 1e13, ctx1); });
+    std::thread t2([&] { res2 = pi((int64_t) 1e13, ctx2); });
+    t1.join();
+    t2.join();
+
+    std::cout << "pi(1e13, ctx1) = " << res1;
+    check(res1 == 346065536839ll);
+    std::cout << "pi(1e13, ctx2) = " << res2;
+    check(res2 == 346065536839ll);
+    std::cout << "ctx1 alpha_y = 2.000";
+    check(contains(out1.str(), "alpha_y = 2.000"));
+    std::cout << "ctx1 alpha_z = 1.500";
+    check(contains(out1.str(), "alpha_z = 1.500"));
+    std::cout << "ctx2 alpha_y = 3.000";
+    check(contains(out2.str(), "alpha_y = 3.000"));
+    std::cout << "ctx2 alpha_z = 1.250";
+    check(contains(out2.str(), "alpha_z = 1.250"));
+    std::cout << "ctx1 threads = 1";
+    check(contains(out1.str(), "threads = 1"));
+    std::cout << "ctx1 output does not contain ctx2 output";
+    check(!contains(out1.str(), "alpha_y = 3.000"));
+  }
+
+  // Memory budget
+  {
+    context ctx;
+    ctx.max_memory = 1 << 10;
+    bool error = false;
+
+    try {
+      pi((int64_t) 1e15, ctx);
+    }
+    catch (const primecount_error&) {
+      error = true;
+    }
+
+    std::cout << "pi(1e15, max_memory = 1 KiB) throws primecount_error";
+    check(error);
+
+    ctx.max_memory = 1 << 30;
+    int64_t res = pi((int64_t) 1e12, ctx);
+    std::cout << "pi(1e12, max_memory = 1 GiB) = " << res;
+    check(res == 37607912018ll);
+  }
+
+  // Cancellation token
+  {
+    cancel_token token;
+    token.cancel();
+    context ctx;
+    ctx.cancel = &token;
+    bool cancelled = false;
+
+    try {
+      pi((int64_t) 1e15, ctx);
+    }
+    catch (const primecount_cancelled&) {
+      cancelled = true;
+    }
+
+    std::cout << "pi(1e15, cancelled ctx) throws primecount_cancelled";
+    check(cancelled);
+  }
+
+  // pi_range(a, b) computes pi(a - 1) in a
+  // separate thread using the same context.
+  {
+    context ctx;
+    ctx.threads = 2;
+    int64_t res = pi_range((int64_t) 1e12, (int64_t) 1e13, ctx);
+    std::cout << "pi_range(1e12, 1e13, ctx) = " << res;
+    check(res == 346065536839ll - 37607912018ll);
+
+    std::string str = pi_range("1e12", "1e13", ctx);
+    std::cout << "pi_range(\"1e12\", \"1e13\", ctx) = " << str;
+    check(str == "308457624821");
+
+    cancel_token token;
+    token.set_timeout(0.2);
+    ctx.cancel = &token;
+    bool cancelled = false;
+    auto start = std::chrono::steady_clock::now();
+
+    try {
+      pi_range((int64_t) 1e17, (int64_t) 1e18, ctx);
+    }
+    catch (const primecount_cancelled&) {
+      cancelled = true;
+    }
+
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+    std::cout << "pi_range(1e17, 1e18, ctx timeout 0.2s) throws primecount_cancelled";
+    check(cancelled);
+    std::cout << "both threads stopped after " << seconds.count() << " seconds";
+    check(seconds.count() < 10);
+  }
+
+  // Test the C API
+  {
+    primecount_ctx* ctx = primecount_ctx_create();
+    primecount_ctx_set_num_threads(ctx, 1);
+    primecount_ctx_set_alpha_y(ctx, 2);
+    int64_t res = primecount_ctx_pi(ctx, (int64_t) 1e12);
+    std::cout << "primecount_ctx_pi(1e12) = " << res;
+    check(res == 37607912018ll);
+
+    char buffer[32];
+    int len = primecount_ctx_pi_str(ctx, "1e12", buffer, sizeof(buffer));
+    std::cout << "primecount_ctx_pi_str(1e12) = " << buffer;
+    check(len > 0 && std::string(buffer) == "37607912018");
+
+    res = primecount_ctx_nth_prime(ctx, (int64_t) 1e9);
+    std::cout << "primecount_ctx_nth_prime(1e9) = " << res;
+    check(res == 22801763489ll);
+
+    primecount_cancel_token* token = primecount_cancel_token_create();
+    primecount_cancel(token);
+    primecount_ctx_set_cancel_token(ctx, token);
+    res = primecount_ctx_pi(ctx, (int64_t) 1e15);
+    std::cout << "primecount_ctx_pi(1e15, cancelled) = " << res;
+    check(res == -2);
+
+    primecount_ctx_set_cancel_token(ctx, NULL);
+    primecount_cancel_token_destroy(token);
+    primecount_ctx_set_max_memory(ctx, 1 << 10);
+    res = primecount_ctx_pi(ctx, (int64_t) 1e15);
+    std::cout << "primecount_ctx_pi(1e15, max_memory = 1 KiB) = " << res;
+    check(res == -1);
+    primecount_ctx_destroy(ctx);
+  }
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
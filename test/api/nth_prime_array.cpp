@@ -0,0 +1,100 @@
+///
+/// @file   nth_prime_array.cpp
+/// @brief  Test the batched nth_prime(std::vector<int64_t>)
+///         function which finds the nth primes of many n.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount.h>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+int main()
+{
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int64_t> dist(1, (int64_t) 1e10);
+  std::uniform_int_distribution<int64_t> small_dist(1, 100000);
+  std::vector<int64_t> n;
+
+  // Tiny and small n
+  for (int64_t i = 1; i < 200; i += 7)
+    n.push_back(i);
+
+  // Clusters of nearby nth primes, unsorted,
+  // with duplicates and far apart clusters.
+  for (int i = 0; i < 5; i++)
+  {
+    int64_t start = dist(gen);
+    for (int j = 0; j < 20; j++)
+      n.push_back(start + small_dist(gen));
+    for (int j = 0; j < 5; j++)
+      n.push_back(start + j);
+    n.push_back(start);
+    n.push_back(start + (int64_t) 1e7);
+  }
+
+  std::vector<int64_t> res = nth_prime(n);
+  std::cout << "nth_prime(std::vector) size = " << res.size();
+  check(res.size() == n.size());
+
+  for (std::size_t i = 0; i < n.size(); i++)
+  {
+    int64_t prime = nth_prime(n[i]);
+    std::cout << "nth_prime(" << n[i] << ") = " << res[i];
+    check(res[i] == prime);
+  }
+
+  res = nth_prime(std::vector<int64_t>());
+  std::cout << "nth_prime(empty vector) size = " << res.size();
+  check(res.empty());
+
+  try
+  {
+    nth_prime(std::vector<int64_t>{ 100, 0 });
+    std::cout << "nth_prime({ 100, 0 })";
+    check(false);
+  }
+  catch (const primecount_error& e)
+  {
+    std::cout << "nth_prime({ 100, 0 }): " << e.what();
+    check(true);
+  }
+
+  // Test the C API
+  int64_t c_n[3] = { 1000000000, 1000000001, 10 };
+  int64_t c_res[3];
+  std::cout << "primecount_nth_prime_array()";
+  check(primecount_nth_prime_array(c_n, c_res, 3) == 0);
+  std::cout << "nth_prime(10^9) = " << c_res[0];
+  check(c_res[0] == 22801763489ll);
+  std::cout << "nth_prime(10^9 + 1) = " << c_res[1];
+  check(c_res[1] == nth_prime(1000000001));
+  std::cout << "nth_prime(10) = " << c_res[2];
+  check(c_res[2] == 29);
+  std::cout << "primecount_nth_prime_array(NULL)";
+  check(primecount_nth_prime_array(NULL, c_res, 3) == -1);
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+///
+/// @file   pi_range.cpp
+/// @brief  Test pi_range(a, b) which counts the primes inside [a, b].
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount.h>
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+int main()
+{
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int64_t> dist(0, (int64_t) 1e9);
+
+  // Short intervals are sieved
+  for (int i = 0; i < 100; i++)
+  {
+    int64_t a = dist(gen);
+    int64_t b = a + dist(gen) / 1000;
+    int64_t res = pi_range(a, b);
+    std::cout << "pi_range(" << a << ", " << b << ") = " << res;
+    check(res == (int64_t) primesieve::count_primes(a, b));
+  }
+
+  // Long intervals
+  for (int i = 0; i < 10; i++)
+  {
+    int64_t a = dist(gen) * 1000;
+    int64_t b = a + dist(gen) * 100;
+    int64_t res = pi_range(a, b);
+    std::cout << "pi_range(" << a << ", " << b << ") = " << res;
+    check(res == pi(b) - pi(a - 1));
+  }
+
+  int64_t res = pi_range(10, 1);
+  std::cout << "pi_range(10, 1) = " << res;
+  check(res == 0);
+
+  res = pi_range(-10, 10);
+  std::cout << "pi_range(-10, 10) = " << res;
+  check(res == 4);
+
+  res = pi_range(97, 97);
+  std::cout << "pi_range(97, 97) = " << res;
+  check(res == 1);
+
+  res = pi_range((int64_t) 1e12, (int64_t) 1e13);
+  std::cout << "pi_range(10^12, 10^13) = " << res;
+  check(res == 346065536839ll - 37607912018ll);
+
+  std::string str = pi_range("1e12", "1e13");
+  std::cout << "pi_range(\"1e12\", \"1e13\") = " << str;
+  check(str == "308457624821");
+
+  // Test the C API
+  res = primecount_pi_range(1000, 2000);
+  std::cout << "primecount_pi_range(1000, 2000) = " << res;
+  check(res == 135);
+
+  char buf[32];
+  int len = primecount_pi_range_str("1000", "2000", buf, sizeof(buf));
+  std::cout << "primecount_pi_range_str(1000, 2000) = " << buf;
+  check(len == 3 && std::string(buf) == "135");
+
+  len = primecount_pi_range_str(NULL, "2000", buf, sizeof(buf));
+  std::cout << "primecount_pi_range_str(NULL, 2000)";
+  check(len == -1);
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+///
+/// @file   pi_table_file.cpp
+/// @brief  Test computing pi(x) using a pi table file.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount.h>
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+int main()
+{
+  std::string filename = "primecount-pi-table-test.dat";
+  int64_t max_x = (int64_t) 1e7 + 123;
+  generate_pi_table(filename, max_x);
+  load_pi_table(filename);
+
+  for (int64_t x = 0; x < 100000; x += 97)
+  {
+    int64_t res = pi(x);
+    std::cout << "pi(" << x << ") = " << res;
+    check(res == (int64_t) primesieve::count_primes(0, x));
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int64_t> dist(0, max_x);
+
+  for (int i = 0; i < 1000; i++)
+  {
+    int64_t x = dist(gen);
+    int64_t res = pi(x);
+    std::cout << "pi(" << x << ") = " << res;
+    check(res == (int64_t) primesieve::count_primes(0, x));
+  }
+
+  int64_t res = pi(max_x);
+  std::cout << "pi(" << max_x << ") = " << res;
+  check(res == (int64_t) primesieve::count_primes(0, max_x));
+
+  // x > max_x is computed as usual
+  int64_t x = max_x + 1000;
+  res = pi(x);
+  std::cout << "pi(" << x << ") = " << res;
+  check(res == (int64_t) primesieve::count_primes(0, x));
+
+  // Truncated file
+  std::string truncated = "primecount-pi-table-truncated.dat";
+  {
+    std::ifstream in(filename, std::ios::binary);
+    std::ofstream out(truncated, std::ios::binary);
+    std::string data(1000, '\0');
+    in.read(&data[0], data.size());
+    out.write(data.data(), data.size());
+  }
+
+  try
+  {
+    load_pi_table(truncated);
+    std::cout << "load_pi_table(truncated)";
+    check(false);
+  }
+  catch (const primecount_error& e)
+  {
+    std::cout << "load_pi_table(truncated): " << e.what();
+    check(true);
+  }
+
+  std::remove(truncated.c_str());
+
+  try
+  {
+    load_pi_table("primecount-pi-table-does-not-exist.dat");
+    std::cout << "load_pi_table(does not exist)";
+    check(false);
+  }
+  catch (const primecount_error& e)
+  {
+    std::cout << "load_pi_table(does not exist): " << e.what();
+    check(true);
+  }
+
+  // Test the C API
+  std::string filename2 = "primecount-pi-table-test2.dat";
+  std::cout << "primecount_load_pi_table(NULL)";
+  check(primecount_load_pi_table(NULL) == -1);
+  std::cout << "primecount_generate_pi_table(-1)";
+  check(primecount_generate_pi_table(filename2.c_str(), -1) == -1);
+  std::cout << "primecount_generate_pi_table(" << filename2 << ", 1e6)";
+  check(primecount_generate_pi_table(filename2.c_str(), (int64_t) 1e6) == 0);
+  std::cout << "primecount_load_pi_table(" << filename2 << ")";
+  check(primecount_load_pi_table(filename2.c_str()) == 0);
+
+  x = 999983;
+  res = primecount_pi(x);
+  std::cout << "primecount_pi(" << x << ") = " << res;
+  check(res == 78498);
+
+  // Lookups run concurrently with loading another table
+  {
+    std::atomic<bool> ok(true);
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+      threads.emplace_back([&]
+      {
+        while (!stop)
+          if (pi((int64_t) 999983) != 78498)
+            ok = false;
+      });
+    }
+
+    for (int i = 0; i < 10; i++)
+      load_pi_table((i % 2) ? filename : filename2);
+
+    stop = true;
+    for (auto& thread : threads)
+      thread.join();
+
+    std::cout << "Concurrent pi(999983) = 78498";
+    check(ok);
+  }
+
+  std::remove(filename.c_str());
+  std::remove(filename2.c_str());
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
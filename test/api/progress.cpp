@@ -0,0 +1,111 @@
+///
+/// @file   progress.cpp
+/// @brief  Test the progress callback API of primecount's
+///         C++ and C APIs.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount.hpp>
+#include <primecount.h>
+
+#include <stdint.h>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+std::atomic<int> c_calls(0);
+
+void c_callback(const ::pc_progress_t* progress, void* data)
+{
+  if (progress &&
+      progress->percent >= 0 &&
+      progress->percent <= 100 &&
+      data == (void*) &c_calls)
+    c_calls++;
+}
+
+int main()
+{
+  std::mutex mutex;
+  std::set<std::string> formulas;
+  std::atomic<int> calls(0);
+  std::atomic<int> errors(0);
+
+  set_progress_callback([&](const primecount::pc_progress_t& progress)
+  {
+    calls++;
+    if (!progress.formula ||
+        progress.percent < 0 ||
+        progress.percent > 100 ||
+        progress.seconds < 0)
+      errors++;
+    else
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      formulas.insert(progress.formula);
+    }
+  });
+
+  // Progress is reported at most every 0.1 seconds, we
+  // use a single thread to ensure that the computation
+  // runs long enough even on fast CPUs.
+  set_num_threads(1);
+  int64_t x = (int64_t) 1e15;
+  int64_t res = pi(x);
+  std::cout << "pi(" << x << ") = " << res;
+  check(res == 29844570422669ll);
+
+  std::cout << "progress calls = " << calls;
+  check(calls > 0);
+  std::cout << "progress errors = " << errors;
+  check(errors == 0);
+
+  // Nested pi(x) computations must not
+  // report any progress.
+  for (const std::string& formula : formulas)
+  {
+    std::cout << "formula = " << formula;
+    check(formula == "Sigma" || formula == "Phi0" ||
+          formula == "AC" || formula == "B" || formula == "D");
+  }
+
+  // Disable the progress callback
+  set_progress_callback(nullptr);
+  int old_calls = calls;
+  res = pi(x);
+  std::cout << "pi(" << x << ") = " << res;
+  check(res == 29844570422669ll);
+  std::cout << "progress calls after disabling = " << calls - old_calls;
+  check(calls == old_calls);
+
+  // Test the C API
+  primecount_set_progress_callback(c_callback, (void*) &c_calls);
+  res = primecount_pi(x);
+  std::cout << "primecount_pi(" << x << ") = " << res;
+  check(res == 29844570422669ll);
+  std::cout << "C progress calls = " << c_calls;
+  check(c_calls > 0);
+  primecount_set_progress_callback(NULL, NULL);
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,50 @@
+# Test the bulk mode: primecount --stdin and primecount --input=FILE
+
+# Run primecount with the given input and check its output
+function(check input expected)
+    file(WRITE "${WORK_DIR}/bulk_input.txt" "${input}")
+    execute_process(COMMAND ${PRIMECOUNT} ${ARGN}
+                    INPUT_FILE "${WORK_DIR}/bulk_input.txt"
+                    OUTPUT_VARIABLE output
+                    RESULT_VARIABLE result)
+    string(REPLACE ";" " " args "${ARGN}")
+    if(NOT result EQUAL 0 OR NOT output STREQUAL expected)
+        message(FATAL_ERROR "primecount ${args}\ninput:\n${input}\noutput:\n${output}\nexpected:\n${expected}")
+    endif()
+    message(STATUS "primecount ${args}   OK")
+endfunction()
+
+# The results are printed in the order of the input,
+# empty lines and comments are skipped.
+check("1e10\n100\n# comment\n\n1000\n100\n" "455052511\n25\n168\n25\n" --stdin)
+check("10\n1\n100\n" "29\n2\n541\n" --stdin --nth-prime)
+
+# Nearby numbers are clustered, the primes inside the gaps are
+# counted using the sieve of Eratosthenes. The results must
+# match the results of the individual computations.
+set(numbers 1000100 999000 1000000 123456789 123400000 2000000 999000)
+set(input "")
+set(expected "")
+foreach(x ${numbers})
+    execute_process(COMMAND ${PRIMECOUNT} ${x} OUTPUT_VARIABLE res)
+    string(APPEND input "${x}\n")
+    string(APPEND expected "${res}")
+endforeach()
+check("${input}" "${expected}" --stdin)
+
+# --input=FILE writes the last completed line to FILE.checkpoint
+set(file "${WORK_DIR}/bulk_file.txt")
+file(WRITE "${file}" "100\n\n1000\n10000\n")
+file(REMOVE "${file}.checkpoint")
+check("" "25\n168\n1229\n" --input=${file})
+file(READ "${file}.checkpoint" checkpoint)
+if(NOT checkpoint STREQUAL "4\n")
+    message(FATAL_ERROR "invalid checkpoint: ${checkpoint}")
+endif()
+
+# --resume skips the lines that have already been completed
+file(WRITE "${file}.checkpoint" "3\n")
+check("" "1229\n" --input=${file} --resume)
+file(WRITE "${file}.checkpoint" "4\n")
+check("" "" --input=${file} --resume)
+file(REMOVE "${file}" "${file}.checkpoint")
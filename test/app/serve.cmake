@@ -0,0 +1,50 @@
+# Test the query server: primecount --serve
+
+file(WRITE "${WORK_DIR}/serve_input.txt"
+"pi 1e12
+nth_prime 10^9
+# comment
+
+phi 1000 3
+foo 1
+pi 1000000000000
+RiemannR 100
+quit
+pi 1e15
+")
+
+execute_process(COMMAND ${PRIMECOUNT} --serve
+                INPUT_FILE "${WORK_DIR}/serve_input.txt"
+                OUTPUT_VARIABLE output
+                RESULT_VARIABLE result)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "primecount --serve failed:\n${output}")
+endif()
+
+# The responses are written in the order in which
+# the computations finish, each response repeats
+# its request.
+set(responses
+    "pi 1e12 = 37607912018\n"
+    "nth_prime 10^9 = 22801763489\n"
+    "phi 1000 3 = 266\n"
+    "foo 1 = error: unknown request 'foo'\n"
+    "pi 1000000000000 = 37607912018\n"
+    "RiemannR 100 = 25\n")
+
+foreach(response ${responses})
+    string(FIND "${output}" "${response}" pos)
+    if(pos EQUAL -1)
+        message(FATAL_ERROR "missing response: ${response}output:\n${output}")
+    endif()
+    string(STRIP "${response}" response)
+    message(STATUS "${response}   OK")
+endforeach()
+
+# The requests after quit are ignored
+string(REGEX MATCHALL "\n" lines "${output}")
+list(LENGTH lines count)
+if(NOT count EQUAL 6)
+    message(FATAL_ERROR "expected 6 responses:\n${output}")
+endif()
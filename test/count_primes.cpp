@@ -0,0 +1,70 @@
+///
+/// @file   count_primes.cpp
+/// @brief  Test count_primes(a, b, threads) which counts the
+///         primes inside [a, b] using a segmented sieve of
+///         Eratosthenes.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primecount-internal.hpp>
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstdlib>
+#include <random>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+void test(int64_t a, int64_t b, int threads)
+{
+  int64_t res = count_primes(a, b, threads);
+  int64_t expected = (b < a) ? 0 : (int64_t) primesieve::count_primes(a, b);
+  std::cout << "count_primes(" << a << ", " << b << ", " << threads << ") = " << res;
+  check(res == expected);
+}
+
+int main()
+{
+  // Test tiny intervals, including the primes 2, 3, 5
+  for (int64_t a = 0; a < 300; a += 7)
+    for (int64_t b = a; b < a + 300; b += 11)
+      test(a, b, 1);
+
+  test(10, 9, 1);
+  test(241, 241, 1);
+  test(480, 719, 1);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  // Test intervals spanning multiple chunks
+  {
+    std::uniform_int_distribution<int64_t> dist(0, (int64_t) 1e12);
+    std::uniform_int_distribution<int64_t> dist_size(0, (int64_t) 1e8);
+
+    for (int i = 0; i < 10; i++)
+    {
+      int64_t a = dist(gen);
+      int64_t b = a + dist_size(gen);
+      test(a, b, 1);
+      test(a, b, 4);
+    }
+  }
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
@@ -32,21 +32,16 @@ void check(bool OK)
     std::exit(1);
 }
 
-int main()
+template <bool PrimeIndex>
+void test(int y, int z, int threads)
 {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<int> dist_y(50000, 60000);
-  std::uniform_int_distribution<int> dist_z(1200000, 1500000);
-
-  auto y = dist_y(gen);
-  auto z = dist_z(gen);
-  auto threads = get_num_threads();
   auto lpf = generate_lpf(z);
   auto mpf = generate_mpf(z);
   auto mu = generate_moebius(z);
+  auto pi = generate_pi(z);
+  auto primes = generate_primes<int32_t>(1000);
 
-  FactorTableD<uint16_t> factorTable(y, z, threads);
+  FactorTableD<uint16_t, PrimeIndex> factorTable(y, z, threads);
   int64_t uint16_max = pstd::numeric_limits<uint16_t>::max();
   int64_t limit = factorTable.first_coprime();
   std::vector<int> small_primes = { 2, 3, 5, 7, 11, 13, 17, 19 };
@@ -96,11 +91,43 @@ int main()
       check(factorTable.is_leaf(i) == uint16_max);
     else if (mu[n] == 0)
       check(factorTable.is_leaf(i) == 0);
+    else if (PrimeIndex)
+      check(pi[lpf[n]] * 2 + 1 == factorTable.is_leaf(i) + (factorTable.mu(i) == 1));
     else
       check(lpf[n] == factorTable.is_leaf(i) + (factorTable.mu(i) == 1));
 
+    // n > prime is a hard special leaf for prime = primes[b]
+    // if mu[n] != 0 && lpf[n] > prime && mpf[n] <= y
+    for (int b : { 6, 7, 20, 100 })
+    {
+      int64_t prime = primes[b];
+      if (n <= prime)
+        continue;
+      bool is_leaf = (mu[n] != 0 && lpf[n] > prime);
+      std::cout << "is_leaf(" << n << ", " << prime << ") = " << is_leaf;
+      check(is_leaf == (factorTable.leaf_key(b, prime) < factorTable.is_leaf(i)));
+    }
+
     not_coprime:;
   }
+}
+
+int main()
+{
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int> dist_y(50000, 60000);
+  std::uniform_int_distribution<int> dist_z(1200000, 1500000);
+
+  auto y = dist_y(gen);
+  auto z = dist_z(gen);
+  auto threads = get_num_threads();
+  test<false>(y, z, threads);
+  test<true>(y, z, threads);
+
+  // y < sqrt(z), some of the sieving primes are > y
+  std::uniform_int_distribution<int> dist_y2(100, 1000);
+  test<false>(dist_y2(gen), z, threads);
 
   std::cout << std::endl;
   std::cout << "All tests passed successfully!" << std::endl;
@@ -13,6 +13,7 @@
 #include <imath.hpp>
 
 #include <stdint.h>
+#include <algorithm>
 #include <iostream>
 #include <cstdlib>
 #include <random>
@@ -87,6 +88,21 @@ int main()
   std::cout << "segmentedPi(" << limit-1 << ") = " << segmentedPi[limit-1];
   check(segmentedPi[limit-1] == pi[limit-1]);
 
+  // Non adjacent segments whose PrimePi(low - 1)
+  // is known, like in the LoadBalancerAC.
+  std::uniform_int_distribution<int64_t> dist3(1, limit / segment_size - 1);
+
+  for (int j = 0; j < 100; j++)
+  {
+    low = dist3(gen) * segment_size;
+    high = std::min(low + segment_size, limit);
+    segmentedPi.init(low, high, pi[low - 1]);
+    i = low + dist2(gen) % (high - low);
+
+    std::cout << "segmentedPi(" << i << ") = " << segmentedPi[i];
+    check(segmentedPi[i] == pi[i]);
+  }
+
   std::cout << std::endl;
   std::cout << "All tests passed successfully!" << std::endl;
 
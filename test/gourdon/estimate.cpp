@@ -0,0 +1,120 @@
+///
+/// @file   estimate.cpp
+/// @brief  Test the runtime and memory usage estimate
+///         of Xavier Gourdon's algorithm.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <estimate.hpp>
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <BaseFactorTable.hpp>
+
+#include <stdint.h>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+int main()
+{
+  int threads = get_num_threads();
+
+  // For small x the estimate computes pi(x)
+  // and reports the measured runtime.
+  {
+    int64_t x = (int64_t) 1e10;
+    Estimate est = estimate(x, threads);
+    double seconds = 0;
+    for (const auto& formula : est.formulas)
+      seconds += formula.seconds;
+
+    std::cout << "estimate(" << x << ").sample_x = " << est.sample_x;
+    check(est.sample_x == x);
+    std::cout << "estimate(" << x << ").formulas = " << est.formulas.size();
+    check(est.formulas.size() == 5);
+    std::cout << "estimate(" << x << ").seconds = " << est.seconds;
+    check(est.seconds > 0 && std::abs(est.seconds - seconds) < 1e-9);
+    std::cout << "estimate(" << x << ").peak_memory = " << est.peak_memory;
+    check(est.peak_memory > 0);
+  }
+
+  // The peak memory usage must grow with x
+  {
+    uint64_t prev_peak = 0;
+
+    for (int i = 10; i <= 18; i++)
+    {
+      int64_t x = 1;
+      for (int j = 0; j < i; j++)
+        x *= 10;
+
+      auto tables = gourdon_tables(x, threads);
+      uint64_t peak = gourdon_peak_memory(tables);
+      std::cout << "gourdon_peak_memory(" << x << ") = " << peak;
+      check(peak > prev_peak);
+      prev_peak = peak;
+
+      // FactorTableD uses 2 bytes per number
+      // coprime to 2, 3, 5, 7 and 11.
+      for (const auto& table : tables)
+      {
+        if (std::strcmp(table.name, "FactorTableD") == 0)
+        {
+          auto alpha = get_alpha_gourdon(x);
+          int64_t y = (int64_t) (iroot<3>(x) * alpha.first);
+          int64_t z = (int64_t) (y * alpha.second);
+          uint64_t bytes = (BaseFactorTable::to_index(z) + 1) * 2;
+          std::cout << "FactorTableD(" << z << ") = " << table.bytes << " bytes";
+          check(table.bytes == bytes);
+        }
+      }
+    }
+  }
+
+#ifdef HAVE_INT128_T
+  {
+    int128_t x = 1;
+    for (int i = 0; i < 27; i++)
+      x *= 10;
+
+    auto tables = gourdon_tables(x, threads);
+    uint64_t peak = gourdon_peak_memory(tables);
+    std::cout << "gourdon_peak_memory(10^27) = " << peak;
+    check(peak > ((uint64_t) 1 << 30));
+  }
+
+  // Samples are only computed for x < 2^63,
+  // sample_x must be a sampled x.
+  {
+    int128_t x = 1;
+    for (int i = 0; i < 20; i++)
+      x *= 10;
+
+    Estimate est = estimate(x, threads);
+    std::cout << "estimate(10^20).sample_x = " << est.sample_x;
+    check(est.sample_x >= (int64_t) 1e12 &&
+          est.sample_x <= (int64_t) 1e18);
+    std::cout << "estimate(10^20).seconds = " << est.seconds;
+    check(est.seconds > est.sample_seconds);
+  }
+#endif
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,114 @@
+///
+/// @file   tuning_file.cpp
+/// @brief  Test loading the tuning file generated by
+///         primecount --calibrate. The tuning factors
+///         from the tuning file must be used by
+///         get_alpha_gourdon() and must not change
+///         any pi(x) results.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <gourdon.hpp>
+#include <primecount.hpp>
+#include <primecount-internal.hpp>
+#include <tuning.hpp>
+
+#include <stdint.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+void check_default_tuning()
+{
+  Tuning tuning = get_tuning();
+  Tuning defaults;
+  std::cout << "get_tuning() = default tuning";
+  check(tuning.alpha_yz_factor == defaults.alpha_yz_factor &&
+        tuning.alpha_z == defaults.alpha_z &&
+        tuning.D_threads_exponent == defaults.D_threads_exponent &&
+        tuning.AC_threads_exponent == defaults.AC_threads_exponent);
+}
+
+int main()
+{
+  int threads = get_num_threads();
+  std::string filename = "primecount-tuning-test.txt";
+
+  Tuning tuning;
+  tuning.alpha_yz_factor = 0.8;
+  tuning.alpha_z = 1.5;
+  tuning.D_threads_exponent = 3.2;
+  tuning.AC_threads_exponent = 4.1;
+  write_tuning_file(tuning, filename, "# test\n");
+
+#if defined(_WIN32)
+  _putenv_s("PRIMECOUNT_TUNING_FILE", filename.c_str());
+#else
+  setenv("PRIMECOUNT_TUNING_FILE", filename.c_str(), 1);
+#endif
+
+  std::cout << "get_tuning_file() = " << get_tuning_file();
+  check(get_tuning_file() == filename);
+
+  // libprimecount does not load the tuning file implicitly
+  check_default_tuning();
+  load_tuning_file();
+  Tuning loaded = get_tuning();
+  std::remove(filename.c_str());
+
+  std::cout << "alpha_yz_factor = " << loaded.alpha_yz_factor;
+  check(loaded.alpha_yz_factor == 0.8);
+  std::cout << "alpha_z = " << loaded.alpha_z;
+  check(loaded.alpha_z == 1.5);
+  std::cout << "D_threads_exponent = " << loaded.D_threads_exponent;
+  check(loaded.D_threads_exponent == 3.2);
+  std::cout << "AC_threads_exponent = " << loaded.AC_threads_exponent;
+  check(loaded.AC_threads_exponent == 4.1);
+
+  {
+    int64_t x = (int64_t) 1e15;
+    auto alpha = get_alpha_gourdon(x);
+    std::cout << "get_alpha_gourdon(" << x << ").alpha_z = " << alpha.second;
+    check(alpha.second == 1.5);
+
+    int64_t xz = (int64_t) 1e9;
+    int max_threads = (int) std::pow(xz, 1 / 3.2);
+    std::cout << "get_max_threads_D(" << xz << ") = " << get_max_threads_D(xz);
+    check(get_max_threads_D(xz) == max_threads);
+  }
+
+  // The tuning factors must not change pi(x)
+  {
+    int64_t x = 99999999907ll;
+    int64_t res1 = 4118054810ll;
+    int64_t res2 = pi_gourdon_64(x, threads);
+    std::cout << "pi_gourdon_64(" << x << ") = " << res2;
+    check(res2 == res1);
+
+    x = (int64_t) 1e13;
+    res1 = 346065536839ll;
+    res2 = pi_gourdon_64(x, threads);
+    std::cout << "pi_gourdon_64(" << x << ") = " << res2;
+    check(res2 == res1);
+  }
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
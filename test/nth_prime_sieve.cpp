@@ -10,6 +10,9 @@
 
 #include <nth_prime_sieve.hpp>
 
+#include <primesieve.hpp>
+#include <int128_t.hpp>
+
 #include <stdint.h>
 #include <iostream>
 
@@ -69,6 +72,56 @@ int main()
   std::cout << "nthPrimeSieve.find_nth_prime(10876) = " << prime;
   check(prime == 1000000299997);
 
+  std::cout << std::endl;
+
+  // The sieving primes are carried over to the next
+  // segment if the segments are a constant stride apart.
+  uint64_t start = uint64_t(1e13) + 123;
+  uint64_t dist = 240 * 1000;
+  uint64_t stride = dist * 3;
+
+  for (int i = 0; i < 20; i++)
+  {
+    low = start + i * stride;
+    high = low + dist - 1;
+    nthPrimeSieve.sieve(low, high);
+    uint64_t count = primesieve::count_primes(low, high);
+    std::cout << "nthPrimeSieve.sieve(" << low << ", " << high << ") count = " << nthPrimeSieve.get_count();
+    check(nthPrimeSieve.get_count() == count);
+  }
+
+  // Sieve backwards
+  for (int i = 0; i < 20; i++)
+  {
+    high = start - i * stride;
+    low = high - dist + 1;
+    nthPrimeSieve.sieve(low, high);
+    uint64_t count = primesieve::count_primes(low, high);
+    std::cout << "nthPrimeSieve.sieve(" << low << ", " << high << ") count = " << nthPrimeSieve.get_count();
+    check(nthPrimeSieve.get_count() == count);
+  }
+
+#if defined(HAVE_INT128_T)
+  std::cout << std::endl;
+
+  NthPrimeSieve<int128_t> sieve128;
+  uint128_t start128 = ((uint128_t) 1 << 64) + 12345;
+
+  for (int i = 0; i < 2; i++)
+  {
+    uint128_t low128 = start128 + i * stride;
+    uint128_t high128 = low128 + dist - 1;
+    sieve128.sieve(low128, high128);
+
+    // Compare with a new sieve without carried over sieving primes
+    NthPrimeSieve<int128_t> fresh;
+    fresh.sieve(low128, high128);
+    std::cout << "sieve128.sieve(2^64 + " << (uint64_t) (low128 - ((uint128_t) 1 << 64)) << ") count = " << sieve128.get_count();
+    check(sieve128.get_count() == fresh.get_count() &&
+          sieve128.find_nth_prime(1) == fresh.find_nth_prime(1));
+  }
+#endif
+
   std::cout << std::endl;
   std::cout << "All tests passed successfully!" << std::endl;
 
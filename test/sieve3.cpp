@@ -0,0 +1,101 @@
+///
+/// @file   sieve3.cpp
+/// @brief  Test Sieve::count(stop) for large low values. For
+///         large low values the distance between consecutive
+///         leaves is large and the Sieve class uses a 2nd
+///         level counter to quickly skip many counter
+///         elements.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <Sieve.hpp>
+#include <generate_primes.hpp>
+#include <imath.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <random>
+
+using std::size_t;
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+int main()
+{
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> dist_low((uint64_t) 1e12 / 30, (uint64_t) 1e14 / 30);
+  std::uniform_int_distribution<uint64_t> dist_size(1000000, 2000000);
+
+  uint64_t low = dist_low(gen) * 30;
+  uint64_t segment_size = Sieve::align_segment_size(dist_size(gen));
+  uint64_t high = low + segment_size;
+  uint64_t sqrt_high = isqrt(high);
+  auto primes = generate_primes<int64_t>(sqrt_high);
+
+  Sieve sieve(low, segment_size, primes.size());
+  std::vector<int> sieve2(segment_size, 1);
+  std::uniform_int_distribution<uint64_t> dist_stop(0, segment_size - 1);
+
+  std::cout << "low = " << low << ", segment_size = " << segment_size << std::endl;
+
+  for (size_t i = 1; i < primes.size(); i++)
+  {
+    uint64_t prime = primes[i];
+
+    if (prime <= 5)
+    {
+      sieve.pre_sieve(primes, i, low, high);
+      sieve.init_counter(low, high);
+    }
+    else
+      sieve.cross_off_count(prime, i);
+
+    uint64_t j = ceil_div(low, prime) * prime;
+    for (; j < high; j += prime)
+      sieve2[j - low] = 0;
+
+    if (prime > 5 && (i % 2000 == 0 || i + 1 == primes.size()))
+    {
+      std::vector<uint64_t> stops(100);
+      for (uint64_t& stop : stops)
+        stop = dist_stop(gen);
+
+      std::sort(stops.begin(), stops.end());
+
+      uint64_t start = 0;
+      uint64_t count = 0;
+      bool OK = true;
+
+      // Sieve::count(stop) requires increasing stop numbers
+      for (uint64_t stop : stops)
+      {
+        for (; start <= stop; start++)
+          count += sieve2[start];
+
+        OK &= sieve.count(stop) == count;
+      }
+
+      std::cout << "sieve.count(stop) after crossing off " << prime;
+      check(OK);
+    }
+  }
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,139 @@
+///
+/// @file   sieve4.cpp
+/// @brief  Test the Sieve class using many consecutive segments
+///         and a small segment size. In this case most sieving
+///         primes are larger than the segment size, these are
+///         stored in buckets and have at most one multiple per
+///         segment. Like in the hard special leaves algorithms
+///         the largest sieving primes are only crossed off in the
+///         first few segments.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <Sieve.hpp>
+#include <generate_primes.hpp>
+#include <imath.hpp>
+#include <min.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <random>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+void test(uint64_t low, uint64_t segment_size, uint64_t segments, uint64_t c)
+{
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  // The last segment is smaller
+  uint64_t limit = low + segment_size * segments - segment_size / 3;
+  auto primes = generate_primes<int64_t>(isqrt(limit));
+  uint64_t max_b = primes.size() - 1;
+  Sieve sieve(low, segment_size, max_b);
+
+  std::cout << "Sieve(" << low << ", " << segment_size << "), segments = " << segments;
+  bool OK = true;
+
+  for (uint64_t s = 0; low < limit; low += segment_size, s++)
+  {
+    uint64_t high = min(low + segment_size, limit);
+    std::vector<int> sieve2(high - low, 1);
+
+    // The largest sieving primes are
+    // only used in the first segments.
+    uint64_t last_b = max_b - (max_b - c) * s / segments;
+
+    for (uint64_t i = 1; i <= c; i++)
+    {
+      uint64_t prime = primes[i];
+      uint64_t j = max(ceil_div(low, prime) * prime, prime);
+      for (; j < high; j += prime)
+        sieve2[j - low] = 0;
+    }
+
+    if (low == 0)
+      sieve2[0] = 0;
+
+    sieve.pre_sieve(primes, c, low, high);
+    sieve.init_counter(low, high);
+
+    for (uint64_t b = c + 1; b <= last_b; b++)
+    {
+      uint64_t prime = primes[b];
+      uint64_t prev_count = sieve.get_total_count();
+      uint64_t cnt = 0;
+      sieve.cross_off_count(prime, b);
+
+      uint64_t j = max(ceil_div(low, prime) * prime, prime);
+      for (; j < high; j += prime)
+      {
+        cnt += sieve2[j - low];
+        sieve2[j - low] = 0;
+      }
+
+      OK &= (prev_count - sieve.get_total_count()) == cnt;
+
+      if (b % 500 == 0 || b == last_b)
+      {
+        std::uniform_int_distribution<uint64_t> dist(0, high - low - 1);
+        std::vector<uint64_t> stops(20);
+        for (uint64_t& stop : stops)
+          stop = dist(gen);
+
+        std::sort(stops.begin(), stops.end());
+        uint64_t start = 0;
+        uint64_t count = 0;
+
+        // Sieve::count(stop) requires increasing stop numbers
+        for (uint64_t stop : stops)
+        {
+          for (; start <= stop; start++)
+            count += sieve2[start];
+
+          OK &= sieve.count(stop) == count;
+        }
+      }
+    }
+  }
+
+  check(OK);
+}
+
+int main()
+{
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> dist_low(0, (uint64_t) 1e11 / 240);
+  std::uniform_int_distribution<uint64_t> dist_size(1, 64);
+  std::uniform_int_distribution<uint64_t> dist_c(3, 8);
+
+  test(0, 240, 200, 3);
+  test(240 * 1000, 240, 100, 6);
+
+  for (int i = 0; i < 20; i++)
+  {
+    uint64_t low = dist_low(gen) * 240;
+    uint64_t segment_size = dist_size(gen) * 240;
+    test(low, segment_size, 40, dist_c(gen));
+  }
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+///
+/// @file   sieve_bits.cpp
+/// @brief  Test primesieve::sieve_bits() which sieves the primes
+///         inside [low, high[ directly into a bit array that
+///         uses the same layout as PiTable.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+#include <primesieve/sieve_bits.hpp>
+#include <imath.hpp>
+#include <Vector.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <random>
+
+using namespace primecount;
+
+const int offsets[8] = { 1, 7, 11, 13, 17, 19, 23, 29 };
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+/// Compute the bit array using primesieve::iterator
+Vector<uint64_t> iterator_bits(uint64_t low, uint64_t high)
+{
+  Vector<uint64_t> bits(ceil_div(high - low, 240));
+  std::fill(bits.begin(), bits.end(), 0);
+
+  primesieve::iterator it(std::max(low, (uint64_t) 7), high);
+  uint64_t prime;
+
+  while ((prime = it.next_prime()) < high)
+  {
+    uint64_t n = prime - low;
+    for (int i = 0; i < 8; i++)
+      if (n % 30 == (uint64_t) offsets[i])
+        bits[n / 240] |= 1ull << ((n % 240) / 30 * 8 + i);
+  }
+
+  return bits;
+}
+
+void test(uint64_t low, uint64_t high, std::size_t stride)
+{
+  std::size_t size = ceil_div(high - low, 240);
+  Vector<uint64_t> bits(size * stride);
+  std::fill(bits.begin(), bits.end(), ~0ull);
+  primesieve::sieve_bits(low, high, &bits[0], stride);
+  Vector<uint64_t> expected = iterator_bits(low, high);
+
+  bool OK = true;
+  for (std::size_t i = 0; i < size; i++)
+    OK &= bits[i * stride] == expected[i];
+
+  std::cout << "sieve_bits(" << low << ", " << high << ", stride = " << stride << ")";
+  check(OK);
+}
+
+int main()
+{
+  test(0, 1, 1);
+  test(0, 7, 1);
+  test(0, 8, 1);
+  test(0, 240, 1);
+  test(0, 241, 2);
+  test(0, 100000, 1);
+  test(240, 480, 1);
+  test(240, 242, 2);
+  test(1000 * 240, 1000 * 240 + 12345, 2);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> dist_low(0, (uint64_t) 1e12 / 240);
+  std::uniform_int_distribution<uint64_t> dist_size(1, (uint64_t) 1e7);
+
+  for (int i = 0; i < 50; i++)
+  {
+    uint64_t low = dist_low(gen) * 240;
+    uint64_t high = low + dist_size(gen);
+    test(low, high, 1 + i % 2);
+  }
+
+  // Multiple segments
+  test((uint64_t) 1e15 / 240 * 240, (uint64_t) 1e15 + (uint64_t) 1e8, 2);
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,103 @@
+///
+/// @file   sieve_pre_sieve.cpp
+/// @brief  Test Sieve::pre_sieve(primes, c, low, high) which
+///         removes the multiples of the primes <= primes[c]
+///         using the pre_sieved arrays (for the small primes)
+///         and Sieve::cross_off() (for the remaining primes).
+///         The number of pre-sieved primes depends on the
+///         segment size, hence we test many segment sizes.
+///
+/// Copyright (C) 2025 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <Sieve.hpp>
+#include <generate_primes.hpp>
+#include <imath.hpp>
+#include <min.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <random>
+
+using namespace primecount;
+
+void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+int main()
+{
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> dist_low(0, (uint64_t) 1e12 / 30);
+  std::uniform_int_distribution<uint64_t> dist_size(1, 10000);
+  std::uniform_int_distribution<uint64_t> dist_c(3, 60);
+  auto primes = generate_primes<int64_t>(1000);
+
+  for (int i = 0; i < 50; i++)
+  {
+    uint64_t low = dist_low(gen) * 30;
+    uint64_t c = dist_c(gen);
+
+    // Segment sizes up to 2.4 * 10^6 so
+    // that all pre_sieved arrays are used.
+    uint64_t segment_size = dist_size(gen) * 240;
+    uint64_t high = low + segment_size;
+
+    if (i == 0)
+    {
+      low = 0;
+      c = 60;
+      segment_size = 240 * 10000;
+      high = segment_size;
+    }
+
+    Sieve sieve(low, segment_size, c + 1);
+    sieve.pre_sieve(primes, c, low, high);
+    sieve.init_counter(low, high);
+    std::vector<int> sieve2(segment_size, 1);
+
+    if (low == 0)
+      sieve2[0] = 0;
+
+    for (uint64_t j = 1; j <= c; j++)
+    {
+      uint64_t prime = primes[j];
+      uint64_t k = max(ceil_div(low, prime) * prime, prime);
+      for (; k < high; k += prime)
+        sieve2[k - low] = 0;
+    }
+
+    uint64_t total = 0;
+    for (int n : sieve2)
+      total += n;
+
+    std::uniform_int_distribution<uint64_t> dist_stop(0, segment_size - 1);
+    uint64_t start = dist_stop(gen);
+    uint64_t stop = dist_stop(gen);
+    if (start > stop)
+      std::swap(start, stop);
+
+    uint64_t count = 0;
+    for (uint64_t j = start; j <= stop; j++)
+      count += sieve2[j];
+
+    std::cout << "pre_sieve(c = " << c << ", low = " << low << ", segment_size = " << segment_size << ")";
+    check(sieve.get_total_count() == total &&
+          sieve.count(start, stop) == count);
+  }
+
+  std::cout << std::endl;
+  std::cout << "All tests passed successfully!" << std::endl;
+
+  return 0;
+}